@@ -11,11 +11,14 @@
 #define ASTAR_H
 
 #include <vector>
+#include <memory>
 
 #include "Point.h"
 
-#include "BinaryHeap.h"
 #include "NavMeshManager.h"
+#include "NavGraph.h"
+#include "PathService.h"
+#include "PointSampler.h"
 
 #include "TriangleMesh.h"
 #include "SquareMesh.h"
@@ -26,7 +29,8 @@ class Render;
 \class Astar
 \brief
 	   Does A* pathfinding with given starting point and end point.
-	   There are also variables for that and path smoothing method.
+	   Searches run on worker thread of path service, and the last
+	   finished one is drawn.
 ********************************************************************/
 class Astar
 {
@@ -51,12 +55,19 @@ public:
 	\param meshes
 		   Navigation meshes for new map.
 	********************************************************************/
-	void InitializeMap(std::vector<NavMeshManager::NavMesh>& meshes);
+	void InitializeMap(const std::vector<NavMeshManager::NavMesh>& meshes);
+
+	/*!*******************************************************************
+	\brief
+		   Take result of finished search, if any. Called every frame by
+		   the thread drawing path.
+	********************************************************************/
+	void Poll();
 
 	/*!*******************************************************************
 	\brief
 		   Setter method for start point.
-		   Find path newly after setting.
+		   Find path after setting.
 
 	\param start
 		   New start point.
@@ -74,12 +85,22 @@ public:
 	/*!*******************************************************************
 	\brief
 		   Setter method for weight.
+		   Used from the next search.
 
 	\param weight
 		   New weight.
 	********************************************************************/
 	void SetWeight(float weight);
 	/*!*******************************************************************
+	\brief
+		   Setter method for radius of agent.
+		   Find path newly after setting.
+
+	\param radius
+		   New radius.
+	********************************************************************/
+	void SetRadius(float radius);
+	/*!*******************************************************************
 	\brief
 		   Setter method for color of considered nodes.
 
@@ -104,6 +125,18 @@ public:
 	********************************************************************/
 	void SetPathColor(const Color& color);
 
+	/*!*******************************************************************
+	\brief
+		   Move start point and end point to random points on the
+		   navigation meshes, uniform by area. End point is picked
+		   among meshes connected to start point. Then, find path
+		   newly.
+
+	\return bool
+			False if there is no navigation mesh.
+	********************************************************************/
+	bool SetRandomPoints();
+
 	/*!*******************************************************************
 	\brief
 		   Draws path from start point to end point.
@@ -124,66 +157,10 @@ private:
 	/*!*******************************************************************
 	\brief
 		   Finding path on the navigation meshes using A* algorithm.
+		   Submits request to path service, and returns at once.
+		   Result of older request is dropped.
 	********************************************************************/
 	void FindPath();
-	
-	// Helper functions for A*
-	/*!*******************************************************************
-	\brief
-		   Find node that include given position.
-		   Check bounding box first, and then test for actual polygon.
-
-	\param position
-		   Point to check.
-
-	\return Node*
-			Pointer to node corresponding to given point.
-	********************************************************************/
-	Node* GetNode(const Point& position);
-	/*!*******************************************************************
-	\brief
-		   Check whether given position is inside of box bounding given
-		   navigation mesh.
-
-	\param navMesh
-		   Navigation mesh to check.
-
-	\param position
-		   Point to check.
-
-	\return bool
-			If point is inside box bounding mesh, returns true.
-			Otherwise, return false.
-	********************************************************************/
-	bool CheckMeshBoundingBox(const NavMeshManager::NavMesh& navMesh, const Point& position) const;
-	/*!*******************************************************************
-	\brief
-		   Check whether given position is inside of given navigation mesh.
-
-	\param navMesh
-		   Navigation mesh to check.
-
-	\param position
-		   Point to check.
-
-	\return bool
-			If point is inside mesh, returns true.
-			Otherwise, return false.
-	********************************************************************/
-	bool IsPointInsideMesh(const NavMeshManager::NavMesh& navMesh, const Point& position) const;
-
-	/*!*******************************************************************
-	\brief
-		   Compute heuristic from given position to destination.
-		   Used octile method.
-
-	\param position
-		   Point to compute.
-
-	\return float
-			Return computed heuristic.
-	********************************************************************/
-	float ComputeHeuristic(const Point& position) const;
 
 	// Methods for UI
 	/*!*******************************************************************
@@ -203,58 +180,17 @@ private:
 	********************************************************************/
 	void MoveTriangle(const Point& position);
 
-	// Methods for path smoothing
-	/*!*******************************************************************
-	\brief
-		   Smooth path using simple stupid funnel algorithm.
-	********************************************************************/
-	void FunnelAlgorithm();
-	/*!*******************************************************************
-	\brief
-		   Determine left and right vertex of edge of given mesh.
-
-	\param index
-		   Index of mesh to check.
-
-	\return std::pair<Point, Point>
-			First is left vertex of edge,
-			while second is right vertex of edge.
-	********************************************************************/
-	std::pair<Point, Point> GetLeftRightOfNextEdge(int index);
-	/*!*******************************************************************
-	\brief
-		   Determine left and right vertex of given edge upon given point.
-
-	\param edge
-		   Edge to check.
-
-	\param origin
-		   Standard point.
-
-	\return std::pair<Point, Point>
-			First is left vertex of edge,
-			while second is right vertex of edge.
-	********************************************************************/
-	std::pair<Point, Point> LeftRightPointsOfEdge(const NavMeshManager::Edge& edge, const Point& origin) const;
-
 private:
-	std::vector<NavMeshManager::NavMesh> m_meshes; //!< Container of navigation meshes.
-	std::vector<Node> m_map; //!< Container of nodes for A* pathfinding.
-
-	int m_iteration = -1; //!< Indicates how many times of pathfinding proceeded on the current map. Reset nodes if and only if nodes are old, so do not need to clear all nodes everytime.
-	bool m_pathExists = false; //!< True if there is a valid path between current start point and end point.
-	float m_weight = 1.f; //!< Weight for heuristic. If it is greater than 1, it A* does not guarantee optimal path, but searching speed would be faster. If it is 0, it is as same as dijkstra.
-
-	std::vector<Node*> m_path; //!< Container of nodes of final path.
-	std::vector<Point> m_smoothPath; //!< Container of points on the smoothen path.
-	std::vector<std::pair<Point, Point>> m_visited; //!< Container of all visited nodes. Just for showing.
-	std::vector<std::pair<Point, Point>> m_considered; //!< Container of all nodes pushed on open list. Just for showing.
+	NavGraph m_graph; //!< Graph built from navigation meshes.
+	std::unique_ptr<PathService> m_service; //!< Searches on worker thread. Made again whenever graph is built, so workers never read graph being built.
+	PathService::Result m_result; //!< Path and trace of the last finished search. Just for showing.
+	unsigned m_request = 0; //!< Number of the last submitted request. Older results are dropped.
+	PointSampler m_sampler; //!< Random points on the navigation meshes.
 
 	Point m_start; //!< Beginning point of path.
 	Point m_end; //!< Destination point of path.
-
-	Node* m_startNode = nullptr; //!< The node which start point is included.
-	Node* m_endNode = nullptr; //!< The node which end point is included.
+	float m_weight = 1.f; //!< Weight for heuristic.
+	float m_radius = 0.f; //!< Radius of agent.
 
 	SquareMesh m_square; //!< UI box for showing start point.
 	TriangleMesh m_triangle; //!< UI triangle for showing end point.
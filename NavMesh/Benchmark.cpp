@@ -0,0 +1,897 @@
+/*!*******************************************************************
+\file		  Benchmark.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+
+#include "Benchmark.h"
+
+#include "NavGraph.h"
+#include "PathQuery.h"
+#include "BinaryTree.h"
+#include "IndexedHeap.h"
+#include "PointSampler.h"
+
+namespace
+{
+	const float LayoutWidth = 1300.f; //!< Width of layouts, same as world of the demo.
+	const float LayoutHeight = 800.f; //!< Height of layouts, same as world of the demo.
+	const int PolicyHoleCount = 400; //!< The number of holes of layout for policies.
+	const int PolicyQueryCount = 500; //!< The number of queries run by each combination.
+	const int LandmarkCount = 8; //!< The number of landmarks of landmark heuristic.
+
+	const int MinHoleCount = 10; //!< The smallest number of holes of scalability benchmark.
+	const int LocateCount = 1000; //!< The number of points located for each layout. Locating is slow on big layouts.
+	const int ClusterHoleCount = 50; //!< Average number of holes of each cluster.
+	const int ClusterCellRatio = 4; //!< The number of cells of clustered layout for each hole.
+	const int ClusterTries = 8; //!< The number of random cells tried before taking next free one.
+	const float MazeThickness = 0.1f; //!< Half thickness of maze wall, relative to cell.
+	const float MazeGap = 0.15f; //!< Distance between ends of wall and corners of cell, relative to cell.
+	const float MazeJitter = 0.02f; //!< Random move of points of wall, relative to cell, so no two points have same height.
+
+	const int KernelInputCount = 4096; //!< The number of random inputs of geometry kernels. Small enough to stay in cache.
+	const long long MicroOperationCount = 1 << 20; //!< The number of operations timed for each microbenchmark.
+	const int HeapSizes[] = { 100, 1000, 10000 }; //!< Sizes of open list, from short searches to long ones.
+	const int TreeSizes[] = { 10, 100, 1000 }; //!< Sizes of scan line status of generation.
+	volatile float MicroSink = 0.f; //!< Sum of results of microbenchmarks is stored here, so calls are not optimized away.
+
+	/*!*******************************************************************
+	\struct Query
+	\brief
+		   Pair of points connected to each other.
+	********************************************************************/
+	struct Query
+	{
+		Point m_start; //!< Beginning point.
+		Point m_end; //!< Destination point.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Run all queries by one combination and print one row.
+		   Each query is searched from the beginning, as by the demo.
+	********************************************************************/
+	template <class Heuristic, class CostModel, class OpenList, class Trace>
+	void RunCase(std::ostream& out, const char* names[4], const NavGraph& graph, const Heuristic& heuristic, const QueryFilter& filter, const std::vector<Query>& queries)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		BasicPathQuery<Heuristic, CostModel, OpenList> pathQuery;
+		pathQuery.Initialize(graph);
+		pathQuery.SetFilter(filter);
+		pathQuery.SetHeuristic(heuristic);
+
+		Trace trace;
+		int found = 0;
+		long long expanded = 0;
+		double cost = 0.0;
+
+		const auto begin = Clock::now();
+		for (const Query& query : queries)
+		{
+			pathQuery.SetEnd(query.m_end);
+			pathQuery.SetStart(query.m_start);
+			if (pathQuery.Step(trace) != BasicPathQuery<Heuristic, CostModel, OpenList>::Status::Found) continue;
+
+			++found;
+			expanded += pathQuery.GetStats().m_expanded;
+			cost += pathQuery.GetPathCost();
+		}
+		const std::chrono::duration<double, std::micro> elapsed = Clock::now() - begin;
+
+		const double count = static_cast<double>(std::max(found, 1));
+		out << std::left << std::setw(11) << names[0] << std::setw(10) << names[1] << std::setw(13) << names[2] << std::setw(11) << names[3]
+			<< std::right << std::fixed << std::setprecision(2) << std::setw(12) << elapsed.count() / queries.size()
+			<< std::setw(12) << expanded / count << std::setw(12) << cost / count << std::setw(8) << found << '\n';
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Run every open list and trace with given heuristic and cost.
+	********************************************************************/
+	template <class Heuristic, class CostModel>
+	void RunOpenLists(std::ostream& out, const char* heuristicName, const char* costName, const NavGraph& graph, const Heuristic& heuristic, const QueryFilter& filter, const std::vector<Query>& queries)
+	{
+		const char* names[4][4] = {
+			{ heuristicName, costName, "BinaryHeap", "NullTrace" },
+			{ heuristicName, costName, "BinaryHeap", "FullTrace" },
+			{ heuristicName, costName, "IndexedHeap", "NullTrace" },
+			{ heuristicName, costName, "IndexedHeap", "FullTrace" }
+		};
+
+		RunCase<Heuristic, CostModel, BinaryHeap, NullTrace>(out, names[0], graph, heuristic, filter, queries);
+		RunCase<Heuristic, CostModel, BinaryHeap, FullTrace>(out, names[1], graph, heuristic, filter, queries);
+		RunCase<Heuristic, CostModel, IndexedHeap, NullTrace>(out, names[2], graph, heuristic, filter, queries);
+		RunCase<Heuristic, CostModel, IndexedHeap, FullTrace>(out, names[3], graph, heuristic, filter, queries);
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Run every cost model, open list and trace with given
+		   heuristic.
+	********************************************************************/
+	template <class Heuristic>
+	void RunCostModels(std::ostream& out, const char* heuristicName, const NavGraph& graph, const Heuristic& heuristic, const QueryFilter& filter, const std::vector<Query>& queries)
+	{
+		RunOpenLists<Heuristic, DistanceCost>(out, heuristicName, "Distance", graph, heuristic, filter, queries);
+		RunOpenLists<Heuristic, FilterCost>(out, heuristicName, "Filter", graph, heuristic, filter, queries);
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Add triangle hole, in clockwise order same as
+		   Hole::GetClockwiseVertices.
+	********************************************************************/
+	void AddHole(std::vector<Point>& holes, Point a, Point b, Point c)
+	{
+		if (TriArea(a, b, c) < 0.f)
+			std::swap(b, c);
+
+		holes.push_back(a);
+		holes.push_back(b);
+		holes.push_back(c);
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Add random triangle inside of given cell.
+	********************************************************************/
+	void AddHoleInCell(std::vector<Point>& holes, std::mt19937& random, const Point& corner, float cellWidth, float cellHeight)
+	{
+		std::uniform_real_distribution<float> inCell(0.15f, 0.85f);
+
+		Point points[3];
+		for (auto& point : points)
+		{
+			const float x = inCell(random);
+			const float y = inCell(random);
+			point = corner + Point(x * cellWidth, y * cellHeight);
+		}
+
+		AddHole(holes, points[0], points[1], points[2]);
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Split box into grid of about given number of cells, with
+		   cells close to square.
+	********************************************************************/
+	void ComputeGrid(float width, float height, int cellCount, int& columns, int& rows)
+	{
+		columns = std::max(static_cast<int>(std::ceil(std::sqrt(static_cast<float>(cellCount) * width / height))), 1);
+		rows = std::max((cellCount + columns - 1) / columns, 1);
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Place one hole in each cell of grid, row by row.
+	********************************************************************/
+	void PlaceRandomHoles(std::vector<Point>& holes, std::mt19937& random, float width, float height, int holeCount)
+	{
+		int columns, rows;
+		ComputeGrid(width, height, holeCount, columns, rows);
+
+		const float cellWidth = width / columns;
+		const float cellHeight = height / rows;
+
+		for (int i = 0; i < holeCount; ++i)
+		{
+			const Point corner(-width / 2.f + (i % columns) * cellWidth, -height / 2.f + (i / columns) * cellHeight);
+			AddHoleInCell(holes, random, corner, cellWidth, cellHeight);
+		}
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Place holes in cells of finer grid, picked by normal
+		   distribution around random centers.
+	********************************************************************/
+	void PlaceClusteredHoles(std::vector<Point>& holes, std::mt19937& random, float width, float height, int holeCount)
+	{
+		int columns, rows;
+		ComputeGrid(width, height, holeCount * ClusterCellRatio, columns, rows);
+
+		const float cellWidth = width / columns;
+		const float cellHeight = height / rows;
+		const int cellCount = columns * rows;
+
+		std::vector<Point> centers(std::max(holeCount / ClusterHoleCount, 1));
+		std::uniform_real_distribution<float> inColumns(0.f, static_cast<float>(columns));
+		std::uniform_real_distribution<float> inRows(0.f, static_cast<float>(rows));
+		for (auto& center : centers)
+			center = Point(inColumns(random), inRows(random));
+
+		// Cluster spreads over a few times more cells than its holes.
+		std::uniform_int_distribution<int> pickCenter(0, static_cast<int>(centers.size()) - 1);
+		std::normal_distribution<float> spread(0.f, std::sqrt(static_cast<float>(ClusterHoleCount)));
+		std::vector<bool> isTaken(cellCount, false);
+
+		for (int i = 0; i < holeCount; ++i)
+		{
+			const Point& center = centers[pickCenter(random)];
+
+			int cell = 0;
+			for (int j = 0; j < ClusterTries; ++j)
+			{
+				const int column = std::min(std::max(static_cast<int>(center.X + spread(random)), 0), columns - 1);
+				const int row = std::min(std::max(static_cast<int>(center.Y + spread(random)), 0), rows - 1);
+
+				cell = row * columns + column;
+				if (!isTaken[cell]) break;
+			}
+
+			// There are more cells than holes, so free cell is always found.
+			while (isTaken[cell])
+				cell = (cell + 1) % cellCount;
+
+			isTaken[cell] = true;
+
+			const Point corner(-width / 2.f + (cell % columns) * cellWidth, -height / 2.f + (cell / columns) * cellHeight);
+			AddHoleInCell(holes, random, corner, cellWidth, cellHeight);
+		}
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Carve random maze by depth first search, and place thin hole
+		   along each wall left. Walls are shuffled and only given
+		   number of them are kept, so there are some loops.
+	********************************************************************/
+	void PlaceMazeWalls(std::vector<Point>& holes, std::mt19937& random, float width, float height, int holeCount)
+	{
+		// Perfect maze of columns * rows cells has (columns - 1) * (rows - 1) inner walls.
+		int columns, rows;
+		ComputeGrid(width, height, holeCount, columns, rows);
+		columns = std::max(columns, 2);
+		while ((columns - 1) * (std::max(rows, 2) - 1) < holeCount)
+			++rows;
+		rows = std::max(rows, 2);
+
+		const float cellWidth = width / columns;
+		const float cellHeight = height / rows;
+		const float cellSize = std::min(cellWidth, cellHeight);
+
+		// Bit 1 is open to the right, bit 2 is open to the top.
+		const int cellCount = columns * rows;
+		std::vector<unsigned char> openings(cellCount, 0);
+		std::vector<bool> isVisited(cellCount, false);
+		std::vector<int> stack(1, 0);
+		isVisited[0] = true;
+
+		while (!stack.empty())
+		{
+			const int cell = stack.back();
+			const int column = cell % columns;
+			const int row = cell / columns;
+
+			int neighbors[4];
+			int neighborCount = 0;
+			if (column > 0 && !isVisited[cell - 1]) neighbors[neighborCount++] = cell - 1;
+			if (column < columns - 1 && !isVisited[cell + 1]) neighbors[neighborCount++] = cell + 1;
+			if (row > 0 && !isVisited[cell - columns]) neighbors[neighborCount++] = cell - columns;
+			if (row < rows - 1 && !isVisited[cell + columns]) neighbors[neighborCount++] = cell + columns;
+
+			if (neighborCount == 0)
+			{
+				stack.pop_back();
+				continue;
+			}
+
+			const int next = neighbors[std::uniform_int_distribution<int>(0, neighborCount - 1)(random)];
+			if (next == cell + 1) openings[cell] |= 1;
+			else if (next == cell - 1) openings[next] |= 1;
+			else if (next == cell + columns) openings[cell] |= 2;
+			else openings[next] |= 2;
+
+			isVisited[next] = true;
+			stack.push_back(next);
+		}
+
+		// Wall is cell * 2 + 0 on its right side, or cell * 2 + 1 on its top side.
+		std::vector<int> walls;
+		for (int cell = 0; cell < cellCount; ++cell)
+		{
+			if (cell % columns < columns - 1 && !(openings[cell] & 1)) walls.push_back(cell * 2);
+			if (cell / columns < rows - 1 && !(openings[cell] & 2)) walls.push_back(cell * 2 + 1);
+		}
+
+		std::shuffle(walls.begin(), walls.end(), random);
+		walls.resize(std::min(static_cast<int>(walls.size()), holeCount));
+
+		std::uniform_real_distribution<float> jitter(-MazeJitter * cellSize, MazeJitter * cellSize);
+		const auto shake = [&](const Point& point) { return point + Point(jitter(random), jitter(random)); };
+
+		for (int wall : walls)
+		{
+			const int cell = wall / 2;
+			const Point corner(-width / 2.f + (cell % columns + 1) * cellWidth, -height / 2.f + (cell / columns + 1) * cellHeight);
+			const float thickness = MazeThickness * cellSize;
+
+			if (wall % 2 == 0)
+			{
+				// Right side, from bottom right corner of cell to top right corner.
+				const float gap = MazeGap * cellHeight;
+				AddHole(holes, shake(corner + Point(-thickness, gap - cellHeight)), shake(corner + Point(thickness, gap - cellHeight)), shake(corner + Point(0.f, -gap)));
+			}
+			else
+			{
+				// Top side, from top left corner of cell to top right corner.
+				const float gap = MazeGap * cellWidth;
+				AddHole(holes, shake(corner + Point(gap - cellWidth, -thickness)), shake(corner + Point(gap - cellWidth, thickness)), shake(corner + Point(-gap, 0.f)));
+			}
+		}
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Compute bytes owned by navigation meshes.
+	********************************************************************/
+	size_t GetMemoryUsage(const std::vector<NavMeshManager::NavMesh>& meshes)
+	{
+		size_t bytes = meshes.capacity() * sizeof(NavMeshManager::NavMesh);
+		for (const auto& mesh : meshes)
+		{
+			bytes += mesh.m_edges.capacity() * sizeof(NavMeshManager::Edge);
+			bytes += mesh.m_neighbors.capacity() * sizeof(NavMeshManager::NavMesh*);
+			bytes += mesh.m_clearances.capacity() * sizeof(float);
+		}
+
+		return bytes;
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Get value at given percentile of sorted values, by nearest
+		   rank.
+	********************************************************************/
+	float GetPercentile(const std::vector<float>& sorted, float percentile)
+	{
+		const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.f * sorted.size()));
+		return sorted[std::min(std::max(rank, static_cast<size_t>(1)), sorted.size()) - 1];
+	}
+
+	/*!*******************************************************************
+	\class Table
+	\brief
+		   Prints rows of named values as CSV or JSON. Every row must
+		   have same names in same order.
+	********************************************************************/
+	class Table
+	{
+	public:
+		Table(std::ostream& out, bool isJson)
+			: m_out(out), m_isJson(isJson), m_rowCount(0)
+		{
+			if (m_isJson)
+				m_out << "[\n";
+		}
+
+		~Table()
+		{
+			if (m_isJson)
+				m_out << (m_rowCount > 0 ? "\n]\n" : "]\n");
+		}
+
+		template <class T>
+		void Add(const std::string& name, const T& value)
+		{
+			std::ostringstream text;
+			text << std::fixed << std::setprecision(3) << value;
+			m_fields.emplace_back(name, text.str());
+		}
+
+		void Add(const std::string& name, const char* value)
+		{
+			// Only names of layouts are text, so quotes are never escaped.
+			m_fields.emplace_back(name, m_isJson ? std::string("\"") + value + '"' : std::string(value));
+		}
+
+		void EndRow()
+		{
+			if (m_isJson)
+			{
+				m_out << (m_rowCount > 0 ? ",\n  {" : "  {");
+				for (size_t i = 0; i < m_fields.size(); ++i)
+					m_out << (i > 0 ? ", \"" : "\"") << m_fields[i].first << "\": " << m_fields[i].second;
+				m_out << '}';
+			}
+			else
+			{
+				if (m_rowCount == 0)
+				{
+					for (size_t i = 0; i < m_fields.size(); ++i)
+						m_out << (i > 0 ? "," : "") << m_fields[i].first;
+					m_out << '\n';
+				}
+
+				for (size_t i = 0; i < m_fields.size(); ++i)
+					m_out << (i > 0 ? "," : "") << m_fields[i].second;
+				m_out << '\n';
+			}
+
+			m_out.flush();
+			m_fields.clear();
+			++m_rowCount;
+		}
+
+	private:
+		std::ostream& m_out; //!< Stream to print to.
+		bool m_isJson; //!< True to print JSON.
+		int m_rowCount; //!< The number of rows printed.
+		std::vector<std::pair<std::string, std::string>> m_fields; //!< Names and printed values of current row.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Time given body repeatedly until enough operations are
+		   timed, so overhead of clock is small. Setup runs before each
+		   repetition, and is not timed. One repetition runs before
+		   timing, to warm up cache.
+
+	\param operationCount
+		   The number of operations done by one call of body.
+
+	\return double
+			Nanoseconds per operation.
+	********************************************************************/
+	template <class Setup, class Body>
+	double MeasureNanoseconds(int operationCount, Setup setup, Body body)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		setup();
+		body();
+
+		std::chrono::duration<double, std::nano> elapsed(0.0);
+		long long total = 0;
+		while (total < MicroOperationCount)
+		{
+			setup();
+
+			const auto begin = Clock::now();
+			body();
+			elapsed += Clock::now() - begin;
+
+			total += operationCount;
+		}
+
+		return elapsed.count() / total;
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Print one row of microbenchmark.
+	********************************************************************/
+	void AddMicroRow(Table& table, const char* name, int size, double nanoseconds)
+	{
+		table.Add("operation", name);
+		table.Add("size", size);
+		table.Add("ns_per_op", nanoseconds);
+		table.EndRow();
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Read positive number of option.
+	********************************************************************/
+	bool ParseCount(const char* text, int& count)
+	{
+		char* end = nullptr;
+		const long value = std::strtol(text, &end, 10);
+		if (end == text || *end != '\0' || value <= 0) return false;
+
+		count = static_cast<int>(value);
+		return true;
+	}
+}
+
+int Benchmark::Run(int argc, char* argv[], std::ostream& out)
+{
+	if (argc == 0 || std::strcmp(argv[0], "policies") == 0)
+	{
+		RunPolicies(out);
+		return 0;
+	}
+
+	const bool isMicro = std::strcmp(argv[0], "micro") == 0;
+	if (isMicro || std::strcmp(argv[0], "scalability") == 0)
+	{
+		// Micro benchmark takes only format.
+		ScalabilityOptions options;
+
+		bool isValid = true;
+		for (int i = 1; i < argc && isValid; i += 2)
+		{
+			const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+			int count = 0;
+
+			if (!value)
+				isValid = false;
+			else if (std::strcmp(argv[i], "--format") == 0)
+			{
+				options.m_isJson = std::strcmp(value, "json") == 0;
+				isValid = options.m_isJson || std::strcmp(value, "csv") == 0;
+			}
+			else if (isMicro)
+				isValid = false;
+			else if (std::strcmp(argv[i], "--max-holes") == 0 && ParseCount(value, count))
+				options.m_maxHoles = count;
+			else if (std::strcmp(argv[i], "--max-queries") == 0 && ParseCount(value, count))
+				options.m_maxQueries = count;
+			else if (std::strcmp(argv[i], "--seed") == 0 && ParseCount(value, count))
+				options.m_seed = static_cast<unsigned>(count);
+			else
+				isValid = false;
+		}
+
+		if (isValid)
+		{
+			if (isMicro)
+				RunMicrobenchmarks(out, options.m_isJson);
+			else
+				RunScalability(out, options);
+			return 0;
+		}
+	}
+
+	out << "Usage: --benchmark [policies]\n"
+		<< "       --benchmark scalability [--format csv|json] [--max-holes N] [--max-queries N] [--seed N]\n"
+		<< "       --benchmark micro [--format csv|json]\n";
+	return 1;
+}
+
+void Benchmark::GenerateLayout(NavMeshManager& manager, Layout layout, float width, float height, int holeCount, unsigned seed)
+{
+	std::mt19937 random(seed);
+
+	// Three clockwise points for each hole.
+	std::vector<Point> holes;
+	holes.reserve(holeCount * 3);
+
+	switch (layout)
+	{
+	case Layout::Random:
+		PlaceRandomHoles(holes, random, width, height, holeCount);
+		break;
+	case Layout::Clustered:
+		PlaceClusteredHoles(holes, random, width, height, holeCount);
+		break;
+	case Layout::Maze:
+		PlaceMazeWalls(holes, random, width, height, holeCount);
+		break;
+	}
+
+	// Boundary + holes, linked same as SearchingArea.
+	const int pointCount = static_cast<int>(holes.size());
+	std::vector<NavMeshManager::Vertex> vertices(4 + pointCount);
+
+	const Point boundary[4] = {
+		Point(-width / 2.f, -height / 2.f),
+		Point(width / 2.f, -height / 2.f),
+		Point(width / 2.f, height / 2.f),
+		Point(-width / 2.f, height / 2.f)
+	};
+
+	for (int i = 0; i < 4; ++i)
+	{
+		auto& curr = vertices[i];
+
+		curr.m_position = boundary[i];
+		curr.m_next = &vertices[(i + 1) % 4];
+		curr.m_next->m_prev = &curr;
+	}
+
+	for (int start = 4; start < 4 + pointCount; start += 3)
+	{
+		for (int j = start; j < start + 3; ++j)
+		{
+			auto& curr = vertices[j];
+
+			curr.m_position = holes[j - 4];
+			curr.m_next = &vertices[(j - start + 1) % 3 + start];
+			curr.m_next->m_prev = &curr;
+		}
+	}
+
+	manager.Generate(vertices);
+}
+
+void Benchmark::RunPolicies(std::ostream& out)
+{
+	NavMeshManager manager;
+	GenerateLayout(manager, Layout::Random, LayoutWidth, LayoutHeight, PolicyHoleCount, 1);
+
+	NavGraph graph;
+	graph.Build(manager.GetNavMeshes());
+
+	// Quarter of triangles are mud, so filter cost differs from distance.
+	std::mt19937 random(2);
+	std::uniform_int_distribution<int> quarter(0, 3);
+	for (int i = 0; i < graph.GetTriangleCount(); ++i)
+	{
+		if (quarter(random) == 0)
+			graph.SetArea(i, QueryFilter::Mud);
+	}
+
+	QueryFilter filter;
+	filter.SetCost(QueryFilter::Mud, 2.f);
+
+	// Same queries for every combination, between points connected to each other.
+	PointSampler sampler;
+	sampler.Initialize(graph, 3);
+
+	std::vector<Query> queries(PolicyQueryCount);
+	for (auto& query : queries)
+	{
+		const int triangle = sampler.Sample(query.m_start);
+		sampler.SampleInRegion(triangle, query.m_end);
+	}
+
+	LandmarkHeuristic landmark;
+	landmark.Build(graph, LandmarkCount);
+
+	out << "Policies: " << graph.GetTriangleCount() << " triangles, " << queries.size() << " queries\n";
+	out << std::left << std::setw(11) << "Heuristic" << std::setw(10) << "Cost" << std::setw(13) << "OpenList" << std::setw(11) << "Trace"
+		<< std::right << std::setw(12) << "us/query" << std::setw(12) << "expanded" << std::setw(12) << "path cost" << std::setw(8) << "found" << '\n';
+
+	RunCostModels(out, "Zero", graph, ZeroHeuristic(), filter, queries);
+	RunCostModels(out, "Euclidean", graph, EuclideanHeuristic(), filter, queries);
+	RunCostModels(out, "Octile", graph, OctileHeuristic(), filter, queries);
+	RunCostModels(out, "Landmark", graph, landmark, filter, queries);
+}
+
+void Benchmark::RunScalability(std::ostream& out, const ScalabilityOptions& options)
+{
+	using Clock = std::chrono::steady_clock;
+	using Microseconds = std::chrono::duration<double, std::micro>;
+
+	const Layout layouts[] = { Layout::Random, Layout::Clustered, Layout::Maze };
+	const char* layoutNames[] = { "random", "clustered", "maze" };
+
+	Table table(out, options.m_isJson);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int holeCount = MinHoleCount; holeCount <= options.m_maxHoles; holeCount *= 10)
+		{
+			// Box grows with holes, so holes are as big as holes of policies layout.
+			const float scale = std::sqrt(std::max(static_cast<float>(holeCount) / PolicyHoleCount, 1.f));
+
+			NavMeshManager manager;
+			GenerateLayout(manager, layouts[i], LayoutWidth * scale, LayoutHeight * scale, holeCount, options.m_seed);
+			const NavMeshManager::GenerateStats& stats = manager.GetStats();
+
+			NavGraph graph;
+			auto begin = Clock::now();
+			graph.Build(manager.GetNavMeshes());
+			const Microseconds buildTime = Clock::now() - begin;
+
+			// Same queries for every count. Smaller counts are prefixes of them.
+			PointSampler sampler;
+			sampler.Initialize(graph, options.m_seed);
+
+			std::vector<Query> queries(options.m_maxQueries);
+			for (auto& query : queries)
+			{
+				const int triangle = sampler.Sample(query.m_start);
+				if (triangle >= 0)
+					sampler.SampleInRegion(triangle, query.m_end);
+			}
+
+			const int locateCount = std::min(LocateCount, options.m_maxQueries);
+			int located = 0;
+
+			begin = Clock::now();
+			for (int j = 0; j < locateCount; ++j)
+				located += graph.FindTriangle(queries[j].m_start) >= 0;
+			const Microseconds locateTime = Clock::now() - begin;
+
+			// Time of whole query, including locating both points and smoothing path.
+			PathQuery query;
+			query.Initialize(graph);
+
+			std::vector<float> latencies(queries.size());
+			std::vector<int> foundCounts(queries.size() + 1, 0);
+			std::vector<long long> expandedCounts(queries.size() + 1, 0);
+
+			for (size_t j = 0; j < queries.size(); ++j)
+			{
+				begin = Clock::now();
+				query.SetEnd(queries[j].m_end);
+				query.SetStart(queries[j].m_start);
+				const bool isFound = query.Step() == PathQuery::Status::Found;
+				latencies[j] = static_cast<float>(Microseconds(Clock::now() - begin).count());
+
+				foundCounts[j + 1] = foundCounts[j] + isFound;
+				expandedCounts[j + 1] = expandedCounts[j] + query.GetStats().m_expanded;
+			}
+
+			std::vector<float> sorted;
+			for (int queryCount = 1; queryCount <= options.m_maxQueries; queryCount *= 10)
+			{
+				sorted.assign(latencies.begin(), latencies.begin() + queryCount);
+				std::sort(sorted.begin(), sorted.end());
+
+				double total = 0.0;
+				for (float latency : sorted)
+					total += latency;
+
+				table.Add("layout", layoutNames[i]);
+				table.Add("holes", holeCount);
+				table.Add("vertices", stats.m_vertices);
+				table.Add("triangles", stats.m_triangles);
+				for (int stage = 0; stage < NavMeshManager::StageCount; ++stage)
+					table.Add(std::string(NavMeshManager::GetStageName(static_cast<NavMeshManager::Stage>(stage))) + "_us", stats.m_stageMicroseconds[stage]);
+				table.Add("bake_us", stats.m_totalMicroseconds);
+				table.Add("neighbor_tests", stats.m_neighborTests);
+				table.Add("graph_build_us", buildTime.count());
+				table.Add("mesh_bytes", GetMemoryUsage(manager.GetNavMeshes()));
+				table.Add("graph_bytes", graph.GetMemoryUsage());
+				table.Add("locate_us", locateCount > 0 ? locateTime.count() / locateCount : 0.0);
+				table.Add("located", located);
+				table.Add("queries", queryCount);
+				table.Add("found", foundCounts[queryCount]);
+				table.Add("latency_mean_us", total / queryCount);
+				table.Add("latency_p50_us", GetPercentile(sorted, 50.f));
+				table.Add("latency_p90_us", GetPercentile(sorted, 90.f));
+				table.Add("latency_p99_us", GetPercentile(sorted, 99.f));
+				table.Add("latency_max_us", sorted.back());
+				table.Add("expanded_mean", static_cast<double>(expandedCounts[queryCount]) / queryCount);
+				table.EndRow();
+			}
+		}
+	}
+}
+
+void Benchmark::RunMicrobenchmarks(std::ostream& out, bool isJson)
+{
+	using Edge = NavMeshManager::Edge;
+
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+	std::uniform_real_distribution<float> coordinate(-LayoutWidth / 2.f, LayoutWidth / 2.f);
+
+	Table table(out, isJson);
+
+	float sum = 0.f;
+
+	std::vector<Point> points(KernelInputCount + 2);
+	for (auto& point : points)
+		point = Point(coordinate(random), coordinate(random));
+
+	const auto noSetup = []() {};
+
+	AddMicroRow(table, "GetAngleBetween", KernelInputCount, MeasureNanoseconds(KernelInputCount, noSetup, [&]()
+	{
+		for (int i = 0; i < KernelInputCount; ++i)
+			sum += GetAngleBetween(points[i], points[i + 1]);
+	}));
+	AddMicroRow(table, "TriArea", KernelInputCount, MeasureNanoseconds(KernelInputCount, noSetup, [&]()
+	{
+		for (int i = 0; i < KernelInputCount; ++i)
+			sum += TriArea(points[i], points[i + 1], points[i + 2]);
+	}));
+	AddMicroRow(table, "DistanceBetween", KernelInputCount, MeasureNanoseconds(KernelInputCount, noSetup, [&]()
+	{
+		for (int i = 0; i < KernelInputCount; ++i)
+			sum += DistanceBetween(points[i], points[i + 1]);
+	}));
+
+	// Points around random triangles of policies layout, about half of them inside.
+	{
+		NavMeshManager manager;
+		GenerateLayout(manager, Layout::Random, LayoutWidth, LayoutHeight, PolicyHoleCount, 1);
+
+		NavGraph graph;
+		graph.Build(manager.GetNavMeshes());
+
+		std::uniform_int_distribution<int> pickTriangle(0, graph.GetTriangleCount() - 1);
+		std::vector<int> triangles(KernelInputCount);
+		for (int i = 0; i < KernelInputCount; ++i)
+		{
+			const int triangle = triangles[i] = pickTriangle(random);
+			const Point& a = graph.GetVertex(triangle, 0);
+			points[i] = a + (graph.GetVertex(triangle, 1) - a) * unit(random) + (graph.GetVertex(triangle, 2) - a) * unit(random);
+		}
+
+		int inside = 0;
+		AddMicroRow(table, "IsPointInside", graph.GetTriangleCount(), MeasureNanoseconds(KernelInputCount, noSetup, [&]()
+		{
+			for (int i = 0; i < KernelInputCount; ++i)
+				inside += graph.IsPointInside(triangles[i], points[i]);
+		}));
+		sum += static_cast<float>(inside);
+	}
+
+	// Heap is filled before each repetition which does not fill it.
+	for (int size : HeapSizes)
+	{
+		std::vector<float> costs(size);
+		for (auto& cost : costs)
+			cost = unit(random) * LayoutWidth;
+
+		std::vector<int> order(size);
+		for (int i = 0; i < size; ++i)
+			order[i] = i;
+		std::shuffle(order.begin(), order.end(), random);
+
+		BinaryHeap heap;
+		const auto fill = [&]()
+		{
+			heap.Clear();
+			for (int i = 0; i < size; ++i)
+				heap.Insert(i, costs[i]);
+		};
+
+		AddMicroRow(table, "BinaryHeap::Insert", size, MeasureNanoseconds(size, [&]() { heap.Clear(); }, [&]()
+		{
+			for (int i = 0; i < size; ++i)
+				heap.Insert(i, costs[i]);
+		}));
+		AddMicroRow(table, "BinaryHeap::GetTop", size, MeasureNanoseconds(size, fill, [&]()
+		{
+			for (int i = 0; i < size; ++i)
+				sum += static_cast<float>(heap.GetTop());
+		}));
+		AddMicroRow(table, "BinaryHeap::DecreaseKey", size, MeasureNanoseconds(size, fill, [&]()
+		{
+			for (int node : order)
+				heap.DecreaseKey(node, costs[node], costs[node] * 0.5f);
+		}));
+	}
+
+	// Edges crossing band between -1 and 1 without crossing each other, like edges crossing scan line.
+	for (int size : TreeSizes)
+	{
+		std::vector<Edge> edges(size);
+		for (int i = 0; i < size; ++i)
+		{
+			const float x = (i + unit(random) * 0.5f) * 10.f;
+			edges[i] = Edge(Point(x, -1.f), Point(x + unit(random), 1.f));
+		}
+		std::shuffle(edges.begin(), edges.end(), random);
+
+		std::vector<Point> vertices(size);
+		for (auto& vertex : vertices)
+			vertex = Point(unit(random) * size * 10.f, unit(random) * 2.f - 1.f);
+
+		BinaryTree<Edge> tree;
+		const auto fill = [&]()
+		{
+			tree = BinaryTree<Edge>();
+			for (const Edge& edge : edges)
+				tree.Insert(edge);
+		};
+
+		AddMicroRow(table, "BinaryTree::Insert", size, MeasureNanoseconds(size, [&]() { tree = BinaryTree<Edge>(); }, [&]()
+		{
+			for (const Edge& edge : edges)
+				tree.Insert(edge);
+		}));
+		fill();
+		AddMicroRow(table, "BinaryTree::FindDirectlyLeftOf", size, MeasureNanoseconds(size, noSetup, [&]()
+		{
+			for (const Point& vertex : vertices)
+				sum += tree.FindDirectlyLeftOf(vertex).m_start.X;
+		}));
+		AddMicroRow(table, "BinaryTree::Delete", size, MeasureNanoseconds(size, fill, [&]()
+		{
+			for (const Edge& edge : edges)
+				tree.Delete(edge);
+		}));
+	}
+
+	MicroSink = sum;
+}
\ No newline at end of file
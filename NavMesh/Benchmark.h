@@ -0,0 +1,144 @@
+/*!*******************************************************************
+\headerfile   Benchmark.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for Benchmark class which measures
+			  searches on generated layouts without window.
+********************************************************************/
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <ostream>
+
+#include "NavMeshManager.h"
+
+/*!*******************************************************************
+\class Benchmark
+\brief
+	   Builds layouts of triangle holes and measures generation and
+	   searches on them. Run by "--benchmark" argument, before window
+	   is created.
+********************************************************************/
+class Benchmark
+{
+public:
+	/*!*******************************************************************
+	\enum Layout
+	\brief
+		   How holes are placed inside of box.
+	********************************************************************/
+	enum class Layout
+	{
+		Random, //!< One hole at random position of each cell of grid.
+		Clustered, //!< Holes crowded around random centers, with open space between crowds.
+		Maze //!< Thin holes along walls of random maze, so paths are long and winding.
+	};
+
+	/*!*******************************************************************
+	\struct ScalabilityOptions
+	\brief
+		   Range and output format of scalability benchmark.
+	********************************************************************/
+	struct ScalabilityOptions
+	{
+		bool m_isJson = false; //!< True to print JSON. Otherwise, CSV.
+		int m_maxHoles = 10000; //!< The biggest number of holes. Hole counts are powers of 10 from 10.
+		int m_maxQueries = 10000; //!< The biggest number of queries. Query counts are powers of 10 from 1.
+		unsigned m_seed = 1; //!< Seed of layouts and queries.
+	};
+
+public:
+	/*!*******************************************************************
+	\brief
+		   Run benchmark chosen by command line arguments after
+		   "--benchmark". "policies" or nothing runs RunPolicies.
+		   "scalability" runs RunScalability, followed by options
+		   "--format csv|json", "--max-holes N", "--max-queries N" and
+		   "--seed N". "micro" runs RunMicrobenchmarks, followed by
+		   "--format csv|json".
+
+	\param argc
+		   The number of arguments.
+
+	\param argv
+		   Arguments after "--benchmark".
+
+	\param out
+		   Stream to print to.
+
+	\return int
+			Exit code. 1 if arguments are wrong.
+	********************************************************************/
+	static int Run(int argc, char* argv[], std::ostream& out);
+
+	/*!*******************************************************************
+	\brief
+		   Generate navigation meshes of box with triangle holes.
+		   Holes never overlap or touch each other.
+
+	\param manager
+		   Manager generates the meshes.
+
+	\param layout
+		   How holes are placed.
+
+	\param width
+		   Width of box.
+
+	\param height
+		   Height of box.
+
+	\param holeCount
+		   The number of holes.
+
+	\param seed
+		   Seed of random generator.
+	********************************************************************/
+	static void GenerateLayout(NavMeshManager& manager, Layout layout, float width, float height, int holeCount, unsigned seed);
+
+	/*!*******************************************************************
+	\brief
+		   Run same queries by every combination of BasicPathQuery
+		   policies, and print time, closed nodes and cost of each.
+
+	\param out
+		   Stream to print to.
+	********************************************************************/
+	static void RunPolicies(std::ostream& out);
+	/*!*******************************************************************
+	\brief
+		   Generate every layout with growing number of holes, and run
+		   growing number of queries on each, so complexity of
+		   generation and searches can be tracked across changes.
+		   Each row has time of each stage of generation, memory of
+		   meshes and graph, time to locate point, and percentiles of
+		   query latency.
+		   Box grows with the number of holes, so size of holes stays
+		   same.
+
+	\param out
+		   Stream to print to.
+
+	\param options
+		   Range and output format.
+	********************************************************************/
+	static void RunScalability(std::ostream& out, const ScalabilityOptions& options);
+	/*!*******************************************************************
+	\brief
+		   Time geometry kernels and containers which generation and
+		   searches rest on, in nanoseconds per operation, at sizes
+		   they have in practice. Any replacement can be measured
+		   against current one by same rows.
+
+	\param out
+		   Stream to print to.
+
+	\param isJson
+		   True to print JSON. Otherwise, CSV.
+	********************************************************************/
+	static void RunMicrobenchmarks(std::ostream& out, bool isJson);
+};
+
+#endif // !BENCHMARK_H
\ No newline at end of file
@@ -4,12 +4,12 @@
 \par          email: hn02415 \@ gmail.com
 \date         2020/01/04
 ********************************************************************/
+#include <algorithm>
+
 #include "BinaryHeap.h"
 
-void BinaryHeap::Insert(Node* node)
+void BinaryHeap::Insert(int node, float cost)
 {
-	const float cost = node->m_cost;
-
 	int min = 0;
 	int max = static_cast<int>(m_nodes.size());
 	int mid = (min + max) / 2;
@@ -17,7 +17,7 @@ void BinaryHeap::Insert(Node* node)
 	// Do binary search to find where to insert.
 	while (min != max)
 	{
-		const float mid_cost = m_nodes[mid]->m_cost;
+		const float mid_cost = m_nodes[mid].m_cost;
 
 		// If there is a node having same cost with new node, just insert here.
 		// We do not need to care order among the nodes having same cost.
@@ -36,21 +36,26 @@ void BinaryHeap::Insert(Node* node)
 		mid = (min + max) / 2;
 	}
 
-	m_nodes.insert(m_nodes.begin() + mid, node);
+	m_nodes.insert(m_nodes.begin() + mid, Entry{ cost, node });
 }
 
-Node* BinaryHeap::GetTop()
+int BinaryHeap::GetTop()
 {
-	auto node = m_nodes[0];
+	const int node = m_nodes[0].m_node;
 	m_nodes.erase(m_nodes.begin());
 
 	return node;
 }
 
-void BinaryHeap::DecreaseKey(Node* node, float new_cost)
+float BinaryHeap::GetTopCost() const
+{
+	return m_nodes[0].m_cost;
+}
+
+void BinaryHeap::DecreaseKey(int node, float cost, float new_cost)
 {
 	// Get the position of the node to update.
-	const int index = Find(node);
+	const int index = Find(node, cost);
 
 	int min = 0;
 	int max = index; // New cost is always lower than previous cost, so do not need to look nodes after previous position.
@@ -59,7 +64,7 @@ void BinaryHeap::DecreaseKey(Node* node, float new_cost)
 	// Do binary search to find where to move.
 	while (min != max)
 	{
-		const float mid_cost = m_nodes[mid]->m_cost;
+		const float mid_cost = m_nodes[mid].m_cost;
 
 		// If there is a node having same cost with new cost, just move here.
 		// We do not need to care order among the nodes having same cost.
@@ -83,14 +88,11 @@ void BinaryHeap::DecreaseKey(Node* node, float new_cost)
 		m_nodes[i] = m_nodes[i - 1];
 
 	// Copy the node to the new position.
-	node->m_cost = new_cost;
-	m_nodes[mid] = node;
+	m_nodes[mid] = Entry{ new_cost, node };
 }
 
-int BinaryHeap::Find(Node* node) const
+int BinaryHeap::Find(int node, float cost) const
 {
-	const float cost = node->m_cost;
-
 	int min = 0;
 	int max = static_cast<int>(m_nodes.size());
 	int mid = (min + max) / 2;
@@ -98,7 +100,7 @@ int BinaryHeap::Find(Node* node) const
 	// Do binary search to find where is the given node.
 	while (min != max)
 	{
-		const float mid_cost = m_nodes[mid]->m_cost;
+		const float mid_cost = m_nodes[mid].m_cost;
 
 		// If there is a node having same cost with the node we are looking for,
 		// try to find that node inside this range.
@@ -120,18 +122,18 @@ int BinaryHeap::Find(Node* node) const
 	// Find node from mid to max. If cost becomse different, stops.
 	for (int i = mid; i < max; ++i)
 	{
-		if (m_nodes[i] == node)
+		if (m_nodes[i].m_node == node)
 			return i;
-		else if (m_nodes[i]->m_cost != node->m_cost)
+		else if (m_nodes[i].m_cost != cost)
 			break;
 	}
 
 	// Find node from mid to mid. If cost becomse different, stops.
 	for (int i = mid - 1; i >= min; --i)
 	{
-		if (m_nodes[i] == node)
+		if (m_nodes[i].m_node == node)
 			return i;
-		else if (m_nodes[i]->m_cost != node->m_cost)
+		else if (m_nodes[i].m_cost != cost)
 			break;
 	}
 
@@ -142,4 +144,25 @@ int BinaryHeap::Find(Node* node) const
 bool BinaryHeap::Empty() const
 {
 	return m_nodes.empty();
+}
+
+int BinaryHeap::Size() const
+{
+	return static_cast<int>(m_nodes.size());
+}
+
+void BinaryHeap::Clear()
+{
+	m_nodes.clear();
+}
+
+void BinaryHeap::Rebuild(const std::function<float(int)>& computeCost)
+{
+	for (auto& entry : m_nodes)
+		entry.m_cost = computeCost(entry.m_node);
+
+	// Keep order among the nodes having same cost, so search proceeds as same as before.
+	std::stable_sort(m_nodes.begin(), m_nodes.end(), [](const Entry& lhs, const Entry& rhs) {
+		return lhs.m_cost < rhs.m_cost;
+	});
 }
\ No newline at end of file
@@ -11,44 +11,15 @@
 #define BINARY_HEAP
 
 #include <vector>
-
-#include "NavMeshManager.h"
-
-/*!*******************************************************************
-\struct Node
-\brief
-	   Base data structure for A* pathfinding.
-********************************************************************/
-struct Node
-{
-	/*!*******************************************************************
-	\enum Status
-	\brief
-		   Indicates the list which this node is involved.
-	********************************************************************/
-	enum class Status
-	{
-		Open,
-		Closed,
-		Default
-	};
-
-	Point m_origin = O; //!< The point where path comes to this node. Simply, it is the middle point of the edge which this node and parent node are sharing.
-	Node* m_parent = nullptr; //!< Pointer to parent node. Will be used to restore the path.
-	NavMeshManager::NavMesh* m_navMesh = nullptr; //!< Pointer to navigation mesh of this node.
-
-	float m_cost = 0.f; //!< Sum of given cost and heurstic from origin to start point.
-	float m_given = 0.f; // The actual cost took to come here from end point.
-
-	Status m_status = Status::Default; //!< Variable stores status of this node.
-	int m_iteration = 0; //!< Indicates whether this node has been used in current search. If it has old value, this node needs to be clear.
-};
+#include <functional>
 
 /*!*******************************************************************
 \class BinaryHeap
 \brief
 	   Simple binary searching sorted array.
 	   Node has lowest cost will always be first element.
+	   Only index and cost of each node are stored, so nodes
+	   themselves are never touched while sorting.
 ********************************************************************/
 class BinaryHeap
 {
@@ -59,30 +30,46 @@ public:
 		   keep array be sorted.
 
 	\param node
-		   New node to insert. Must not be already in the container.
+		   Index of new node to insert. Must not be already in the
+		   container.
+
+	\param cost
+		   Cost of new node.
 	********************************************************************/
-	void Insert(Node* node);
+	void Insert(int node, float cost);
 	/*!*******************************************************************
 	\brief
 		   Return node has the lowest cost and delete from that
 		   from the container.
 
-	\return Node*
-			Pointer to node has the lowest cost which is the first
+	\return int
+			Index of node has the lowest cost which is the first
 			element of the container.
 	********************************************************************/
-	Node* GetTop();
+	int GetTop();
+	/*!*******************************************************************
+	\brief
+		   Return the lowest cost without removing the node.
+		   Container must not be empty.
+
+	\return float
+			Cost of the first element of the container.
+	********************************************************************/
+	float GetTopCost() const;
 	/*!*******************************************************************
 	\brief
 		   Update given node with given cost and rearrange the container.
 
 	\param node
-		   Node to update. Must be in the container already.
+		   Index of node to update. Must be in the container already.
+
+	\param cost
+		   Current cost of given node.
 
 	\param new_cost
 		   New cost of given node.
 	********************************************************************/
-	void DecreaseKey(Node* node, float new_cost);
+	void DecreaseKey(int node, float cost, float new_cost);
 	/*!*******************************************************************
 	\brief
 		   Telling whether container is empty or not.
@@ -92,20 +79,59 @@ public:
 			Otherwise, return false.
 	********************************************************************/
 	bool Empty() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of nodes in the container.
+
+	\return int
+			The number of nodes.
+	********************************************************************/
+	int Size() const;
+	/*!*******************************************************************
+	\brief
+		   Remove all nodes from the container.
+	********************************************************************/
+	void Clear();
+	/*!*******************************************************************
+	\brief
+		   Recompute cost of every node in the container and sort again.
+		   Used when the heuristic has been changed during search.
+
+	\param computeCost
+		   Function returns new cost of node with given index.
+	********************************************************************/
+	void Rebuild(const std::function<float(int)>& computeCost);
 
 private:
+	/*!*******************************************************************
+	\struct Entry
+	\brief
+		   Element of the container.
+	********************************************************************/
+	struct Entry
+	{
+		float m_cost; //!< Cost of the node.
+		int m_node; //!< Index of the node.
+	};
+
 	/*!*******************************************************************
 	\brief
 		   Helper method to find the position of given node inside
 		   the container.
 
+	\param node
+		   Index of node to find.
+
+	\param cost
+		   Current cost of the node.
+
 	\return int
 			Index of the node in the container.
 	********************************************************************/
-	int Find(Node* node) const;
+	int Find(int node, float cost) const;
 
 private:
-	std::vector<Node*> m_nodes; //!< Container of nodes which always be sorted by increasing cost order.
+	std::vector<Entry> m_nodes; //!< Container of nodes which always be sorted by increasing cost order.
 };
 
 #endif // !BINARY_HEAP
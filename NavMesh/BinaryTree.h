@@ -65,6 +65,14 @@ public:
 		   Edge to delete, which is not interseting with scan line anymore.
 	********************************************************************/
 	void Delete(const T& edge);
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of edges in the container.
+
+	\return int
+			The number of edges intersecting with scan line.
+	********************************************************************/
+	int Size() const;
 
 private:
 	/*!*******************************************************************
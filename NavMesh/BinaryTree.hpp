@@ -117,4 +117,10 @@ template <class T>
 void BinaryTree<T>::Delete(const T& edge)
 {
 	m_edges.erase(m_edges.begin() + FindIndexOfEdge(edge));
+}
+
+template <class T>
+int BinaryTree<T>::Size() const
+{
+	return static_cast<int>(m_edges.size());
 }
\ No newline at end of file
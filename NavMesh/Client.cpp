@@ -45,6 +45,9 @@ void Client::draw(double dt, bool editMode, bool showAllNodes, bool smoothPath)
 		SDL_SetWindowTitle(m_window, ss.str().c_str());
 	}
 
+	// Path found by worker thread is drawn from this frame.
+	m_world.PollPath();
+
 	// Draw
 	m_render->ClearBuffers();
 	m_world.Draw(m_render, editMode, showAllNodes, smoothPath);
@@ -114,11 +117,21 @@ void Client::GenerateNavMesh()
 	m_world.GenerateNavMesh();
 }
 
+void Client::SetRandomPoints()
+{
+	m_world.SetRandomPoints();
+}
+
 void Client::SetWeight(float weight)
 {
 	m_world.SetWeight(weight);
 }
 
+void Client::SetRadius(float radius)
+{
+	m_world.SetRadius(radius);
+}
+
 void Client::SetConsideredColor(const Color& color)
 {
 	m_world.SetConsideredColor(color);
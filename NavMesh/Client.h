@@ -142,6 +142,13 @@ public:
 	********************************************************************/
 	void GenerateNavMesh();
 
+	/*!*******************************************************************
+	\brief
+		   Abstracted method for moving both ends of path to random
+		   points connected to each other.
+		   Call related method of object under hierarchy.
+	********************************************************************/
+	void SetRandomPoints();
 	/*!*******************************************************************
 	\brief
 		   Abstracted setter method for weight.
@@ -151,6 +158,14 @@ public:
 	********************************************************************/
 	void SetWeight(float weight);
 	/*!*******************************************************************
+	\brief
+		   Abstracted setter method for radius of agent.
+
+	\param radius
+		   New radius.
+	********************************************************************/
+	void SetRadius(float radius);
+	/*!*******************************************************************
 	\brief
 		   Abstracted setter method for color of considered nodes.
 
@@ -0,0 +1,378 @@
+/*!*******************************************************************
+\file		  Crowd.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+
+#include "Crowd.h"
+
+namespace
+{
+	const float TimeHorizon = 1.f; //!< Collisions later than this are ignored.
+	const float CollisionWeight = 2.f; //!< How much to avoid collision rather than keeping desired velocity.
+	const int MaxNeighbors = 10; //!< Only the nearest ones are considered.
+	const int SampleDirections = 12; //!< The number of directions of sampled velocities.
+	const int SampleRings = 3; //!< The number of speeds of sampled velocities.
+	const int ChunkSize = 64; //!< The number of agents each thread takes at once.
+	const int MaxCorners = 2; //!< The number of corners agent looks ahead.
+	const int MaxLookAhead = 8; //!< The number of triangles checked whether corridor is broken.
+	const int MaxReplans = 4; //!< Default number of searches in one update.
+
+	float Dot(const Vector& v1, const Vector& v2)
+	{
+		return v1.X * v2.X + v1.Y * v2.Y;
+	}
+}
+
+Crowd::Crowd(const NavGraph& graph, int threadCount)
+	: m_graph(graph), m_pool(threadCount), m_neighbors(m_pool.GetThreadCount()), m_maxReplans(MaxReplans)
+{
+	m_query.Initialize(graph);
+
+	// Corridors only walk on triangles, so agents cannot follow off-mesh links.
+	QueryFilter filter;
+	filter.SetOffMeshLinksIncluded(false);
+	m_query.SetFilter(filter);
+}
+
+int Crowd::AddAgent(const Point& position, float radius, float maxSpeed)
+{
+	const int triangle = m_graph.FindTriangle(position);
+	if (triangle < 0)
+		return -1;
+
+	// Reuse slot of removed agent first.
+	int agent;
+	if (!m_freeSlots.empty())
+	{
+		agent = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		agent = static_cast<int>(m_agents.size());
+		m_agents.push_back(Agent());
+		m_positions.push_back(position);
+		m_velocities.push_back(O);
+		m_newVelocities.push_back(O);
+	}
+
+	auto& newAgent = m_agents[agent];
+	newAgent = Agent();
+	newAgent.m_radius = radius;
+	newAgent.m_maxSpeed = maxSpeed;
+	newAgent.m_isActive = true;
+	newAgent.m_corridor.Reset(m_graph, triangle, position, radius);
+
+	m_positions[agent] = position;
+	m_velocities[agent] = O;
+
+	m_maxRadius = std::max(m_maxRadius, radius);
+	m_maxSpeed = std::max(m_maxSpeed, maxSpeed);
+
+	return agent;
+}
+
+void Crowd::RemoveAgent(int agent)
+{
+	m_agents[agent] = Agent();
+	m_velocities[agent] = O;
+	m_freeSlots.push_back(agent);
+}
+
+bool Crowd::SetTarget(int agent, const Point& target)
+{
+	return Replan(agent, target);
+}
+
+bool Crowd::MoveTarget(int agent, const Point& target)
+{
+	// Fix the end of corridor instead of searching again.
+	if (m_agents[agent].m_corridor.MoveTarget(target))
+		return true;
+
+	return Replan(agent, target);
+}
+
+void Crowd::Update(float dt)
+{
+	if (dt <= 0.f) return;
+
+	// Snapshot of positions for neighbor queries. Cell is as large as the range of query.
+	const float range = m_maxRadius * 2.f + m_maxSpeed * TimeHorizon;
+	m_hash.Build(m_positions, std::max(range, 1.f));
+
+	// Choose new velocities. Only reads positions and velocities of others.
+	ForEachAgent([this, dt](int agent, std::vector<int>& neighbors) {
+		const Vector desired = ComputeDesiredVelocity(agent, dt);
+		m_newVelocities[agent] = SelectVelocity(agent, desired, neighbors);
+	});
+
+	// Blocked triangles may have changed anywhere, so whole corridors are checked once.
+	const bool isGraphChanged = m_graph.GetVersion() != m_graphVersion;
+	const int lookAhead = isGraphChanged ? std::numeric_limits<int>::max() : MaxLookAhead;
+	m_graphVersion = m_graph.GetVersion();
+
+	// Move agents. Each agent only writes its own state.
+	ForEachAgent([this, dt, lookAhead](int agent, std::vector<int>&) {
+		auto& thisAgent = m_agents[agent];
+		Point& position = m_positions[agent];
+
+		// Corridor walks on the surface, and only changes its ends.
+		const Point& reached = thisAgent.m_corridor.MovePosition(position + m_newVelocities[agent] * dt);
+
+		m_velocities[agent] = (reached - position) / dt;
+		position = reached;
+
+		// Agent waiting in queue is known to be broken already.
+		thisAgent.m_isBroken = !thisAgent.m_needsReplan && !thisAgent.m_corridor.IsValid(lookAhead);
+	});
+
+	// Queue newly broken corridors in order of agents.
+	const int size = static_cast<int>(m_agents.size());
+	for (int i = 0; i < size; ++i)
+	{
+		auto& thisAgent = m_agents[i];
+		if (!thisAgent.m_isActive || !thisAgent.m_isBroken) continue;
+
+		thisAgent.m_isBroken = false;
+		thisAgent.m_needsReplan = true;
+		m_replans.push_back(i);
+	}
+
+	// Search shares one query, so only a few broken corridors are fixed here one by one. Rest wait for next updates.
+	for (int replans = 0; replans < m_maxReplans && !m_replans.empty();)
+	{
+		const int agent = m_replans.front();
+		m_replans.pop_front();
+
+		// Removed, or target set by user in the meantime.
+		auto& thisAgent = m_agents[agent];
+		if (!thisAgent.m_isActive || !thisAgent.m_needsReplan) continue;
+
+		Replan(agent, thisAgent.m_corridor.GetTarget());
+		++replans;
+	}
+}
+
+void Crowd::SetMaxReplans(int maxReplans)
+{
+	m_maxReplans = std::max(maxReplans, 1);
+}
+
+int Crowd::GetAgentCount() const
+{
+	return static_cast<int>(m_agents.size());
+}
+
+bool Crowd::IsActive(int agent) const
+{
+	return m_agents[agent].m_isActive;
+}
+
+const Point& Crowd::GetPosition(int agent) const
+{
+	return m_positions[agent];
+}
+
+const Vector& Crowd::GetVelocity(int agent) const
+{
+	return m_velocities[agent];
+}
+
+bool Crowd::HasArrived(int agent) const
+{
+	const auto& thisAgent = m_agents[agent];
+	return DistanceBetween(m_positions[agent], thisAgent.m_corridor.GetTarget()) <= 0.01f * thisAgent.m_radius + 0.001f;
+}
+
+ThreadPool& Crowd::GetThreadPool()
+{
+	return m_pool;
+}
+
+void Crowd::ForEachAgent(const std::function<void(int, std::vector<int>&)>& function)
+{
+	const int size = static_cast<int>(m_agents.size());
+	const int threadCount = (size + ChunkSize - 1) / ChunkSize;
+
+	// Threads take chunks of agents one by one. Less agents than a chunk run on the calling thread only.
+	std::atomic<int> next(0);
+	m_pool.Run(threadCount, [&](int thread) {
+		auto& neighbors = m_neighbors[thread];
+		for (int begin = next.fetch_add(ChunkSize); begin < size; begin = next.fetch_add(ChunkSize))
+		{
+			const int end = std::min(begin + ChunkSize, size);
+			for (int agent = begin; agent < end; ++agent)
+			{
+				if (m_agents[agent].m_isActive)
+					function(agent, neighbors);
+			}
+		}
+	});
+}
+
+Vector Crowd::ComputeDesiredVelocity(int agent, float dt)
+{
+	auto& thisAgent = m_agents[agent];
+	if (HasArrived(agent) || thisAgent.m_needsReplan)
+		return O;
+
+	auto& corners = thisAgent.m_corners;
+	thisAgent.m_corridor.FindCorners(corners, MaxCorners);
+
+	// Corner is passed once agent is within its radius.
+	size_t next = 0;
+	if (corners.size() > 1 && DistanceBetween(m_positions[agent], corners[0]) <= thisAgent.m_radius)
+		next = 1;
+
+	const Vector toCorner = corners[next] - m_positions[agent];
+	const float distance = Magnitude(toCorner);
+	if (distance == 0.f)
+		return O;
+
+	// Do not go over the target in one update.
+	float speed = thisAgent.m_maxSpeed;
+	if (corners[next] == thisAgent.m_corridor.GetTarget())
+		speed = std::min(speed, distance / dt);
+
+	return toCorner * (speed / distance);
+}
+
+Vector Crowd::SelectVelocity(int agent, const Vector& desired, std::vector<int>& neighbors) const
+{
+	const auto& thisAgent = m_agents[agent];
+	const Point& position = m_positions[agent];
+	const Vector& velocity = m_velocities[agent];
+
+	// Find neighbors this agent can reach within horizon, and keep the nearest ones only.
+	neighbors.clear();
+	m_hash.Query(position, thisAgent.m_radius + m_maxRadius + thisAgent.m_maxSpeed * TimeHorizon, neighbors);
+
+	neighbors.erase(std::remove_if(neighbors.begin(), neighbors.end(), [this, agent](int other) {
+		return other == agent || !m_agents[other].m_isActive;
+	}), neighbors.end());
+
+	if (neighbors.empty())
+		return desired;
+
+	if (neighbors.size() > static_cast<size_t>(MaxNeighbors))
+	{
+		std::nth_element(neighbors.begin(), neighbors.begin() + MaxNeighbors, neighbors.end(), [this, &position](int lhs, int rhs) {
+			const Vector toLhs = m_positions[lhs] - position;
+			const Vector toRhs = m_positions[rhs] - position;
+			return Dot(toLhs, toLhs) < Dot(toRhs, toRhs);
+		});
+		neighbors.resize(MaxNeighbors);
+	}
+
+	// Penalty of candidate velocity. Deviation from desired velocity plus how soon it collides.
+	// Stops once it gets over given bound, since candidate cannot be the best then.
+	const auto computePenalty = [&](const Vector& candidate, float bound) {
+		float penalty = Magnitude(candidate - desired);
+
+		for (int other : neighbors)
+		{
+			if (penalty >= bound)
+				break;
+
+			// Reciprocal. Assume other agent takes half of avoidance too.
+			const Vector relativeVelocity = candidate * 2.f - velocity - m_velocities[other];
+			const float time = ComputeTimeToCollision(m_positions[other] - position, relativeVelocity, thisAgent.m_radius + m_agents[other].m_radius);
+
+			if (time == 0.f)
+				penalty += CollisionWeight * thisAgent.m_maxSpeed * TimeHorizon; // Overlapping already. Heavy penalty, but still prefer leaving.
+			else if (time > 0.f && time < TimeHorizon)
+				penalty += CollisionWeight * thisAgent.m_maxSpeed * (TimeHorizon - time) / time;
+		}
+
+		return penalty;
+	};
+
+	Vector best = desired;
+	float bestPenalty = computePenalty(desired, std::numeric_limits<float>::max());
+
+	// Desired velocity is free. Most of agents end here.
+	if (bestPenalty == 0.f)
+		return desired;
+
+	// Rings of sampled velocities around zero, with current velocity and stopping.
+	const float step = 2.f * 3.14159265f / SampleDirections;
+	for (int ring = 1; ring <= SampleRings; ++ring)
+	{
+		const float speed = thisAgent.m_maxSpeed * ring / SampleRings;
+		for (int i = 0; i < SampleDirections; ++i)
+		{
+			// Turn each ring a bit, so samples do not line up.
+			const float angle = step * (i + 0.5f * (ring % 2));
+			const Vector candidate(std::cos(angle) * speed, std::sin(angle) * speed);
+
+			const float penalty = computePenalty(candidate, bestPenalty);
+			if (penalty < bestPenalty)
+			{
+				bestPenalty = penalty;
+				best = candidate;
+			}
+		}
+	}
+
+	for (const Vector& candidate : { velocity, O })
+	{
+		const float penalty = computePenalty(candidate, bestPenalty);
+		if (penalty < bestPenalty)
+		{
+			bestPenalty = penalty;
+			best = candidate;
+		}
+	}
+
+	return best;
+}
+
+float Crowd::ComputeTimeToCollision(const Vector& position, const Vector& velocity, float radius) const
+{
+	// Solve |position - velocity * t| = radius.
+	const float c = Dot(position, position) - radius * radius;
+	if (c <= 0.f)
+		return 0.f;
+
+	const float a = Dot(velocity, velocity);
+	const float b = Dot(position, velocity);
+	if (a == 0.f || b <= 0.f)
+		return -1.f;
+
+	const float discriminant = b * b - a * c;
+	if (discriminant <= 0.f)
+		return -1.f;
+
+	return (b - std::sqrt(discriminant)) / a;
+}
+
+bool Crowd::Replan(int agent, const Point& target)
+{
+	auto& thisAgent = m_agents[agent];
+	auto& corridor = thisAgent.m_corridor;
+	const Point& position = m_positions[agent];
+
+	// Leaves queue, if it was waiting.
+	thisAgent.m_needsReplan = false;
+
+	m_query.SetRadius(thisAgent.m_radius);
+	m_query.SetStart(position);
+	m_query.SetEnd(target);
+
+	if (m_query.Step() != PathQuery::Status::Found)
+	{
+		// Stay where it is.
+		corridor.SetCorridor(position, std::vector<int>(1, corridor.GetFirstTriangle()));
+		return false;
+	}
+
+	corridor.SetCorridor(m_query.GetEnd(), m_query.GetPathTriangles());
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,308 @@
+/*!*******************************************************************
+\headerfile   Crowd.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for Crowd class which moves many agents
+			  along their paths while avoiding each other.
+********************************************************************/
+#ifndef CROWD_H
+#define CROWD_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "PathQuery.h"
+#include "PathCorridor.h"
+#include "SpatialHash.h"
+#include "ThreadPool.h"
+
+/*!*******************************************************************
+\class Crowd
+\brief
+	   Owns many agents walking on navigation meshes. Each agent
+	   follows corridor of its own path, and every update chooses
+	   velocity avoiding neighbors by reciprocal velocity obstacles.
+	   Neighbors are found by spatial hash, and agents are updated
+	   in parallel by thread pool kept for the lifetime of crowd.
+********************************************************************/
+class Crowd
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Constructor that sets graph and the number of threads.
+
+	\param graph
+		   Graph to walk on. Must not be moved or changed while this
+		   crowd uses it.
+
+	\param threadCount
+		   The number of threads updating agents at once, including
+		   the calling thread. If it is less than 2, everything runs on
+		   the calling thread.
+	********************************************************************/
+	Crowd(const NavGraph& graph, int threadCount);
+
+	/*!*******************************************************************
+	\brief
+		   Add new agent standing still.
+
+	\param position
+		   Initial position.
+
+	\param radius
+		   Radius of agent.
+
+	\param maxSpeed
+		   The fastest speed of agent.
+
+	\return int
+			Index of new agent. -1 if position is not inside of polygon.
+	********************************************************************/
+	int AddAgent(const Point& position, float radius, float maxSpeed);
+	/*!*******************************************************************
+	\brief
+		   Remove given agent. Its index can be reused by new agent.
+
+	\param agent
+		   Index of agent.
+	********************************************************************/
+	void RemoveAgent(int agent);
+	/*!*******************************************************************
+	\brief
+		   Find path of given agent to given point. Agent follows it from
+		   the next update.
+
+	\param agent
+		   Index of agent.
+
+	\param target
+		   Destination point.
+
+	\return bool
+			False if there is no path. Agent stops then.
+	********************************************************************/
+	bool SetTarget(int agent, const Point& target);
+	/*!*******************************************************************
+	\brief
+		   Move target of given agent, like following moving object.
+		   Only the end of corridor is fixed, unless target is blocked
+		   by walls or moved too far.
+
+	\param agent
+		   Index of agent.
+
+	\param target
+		   New destination point.
+
+	\return bool
+			False if there is no path. Agent stops then.
+	********************************************************************/
+	bool MoveTarget(int agent, const Point& target);
+
+	/*!*******************************************************************
+	\brief
+		   Move all agents by given time.
+		   Agents whose corridor is broken, like by blocked triangles,
+		   stop and wait in queue. Only a limited number of them find
+		   path again in each update, so one changed door never costs
+		   more than that.
+
+	\param dt
+		   Time passed since last update in seconds.
+	********************************************************************/
+	void Update(float dt);
+	/*!*******************************************************************
+	\brief
+		   Setter method for the number of paths found again by each
+		   update.
+
+	\param maxReplans
+		   The biggest number of searches in one update. At least 1.
+	********************************************************************/
+	void SetMaxReplans(int maxReplans);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of agent slots. Includes removed
+		   agents.
+
+	\return int
+			The biggest index of agent + 1.
+	********************************************************************/
+	int GetAgentCount() const;
+	/*!*******************************************************************
+	\brief
+		   Check whether given slot has an agent.
+
+	\param agent
+		   Index of agent.
+
+	\return bool
+			False if agent has been removed.
+	********************************************************************/
+	bool IsActive(int agent) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for position of given agent.
+
+	\param agent
+		   Index of agent.
+
+	\return const Point&
+			Current position.
+	********************************************************************/
+	const Point& GetPosition(int agent) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for velocity of given agent.
+
+	\param agent
+		   Index of agent.
+
+	\return const Vector&
+			Velocity chosen by the last update.
+	********************************************************************/
+	const Vector& GetVelocity(int agent) const;
+	/*!*******************************************************************
+	\brief
+		   Check whether given agent has nowhere to go.
+
+	\param agent
+		   Index of agent.
+
+	\return bool
+			True if agent reached its target or has no target.
+	********************************************************************/
+	bool HasArrived(int agent) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for threads updating agents. Other systems run
+		   from the same thread, like distance queries, can share them.
+
+	\return ThreadPool&
+			Pool owned by this crowd.
+	********************************************************************/
+	ThreadPool& GetThreadPool();
+
+private:
+	/*!*******************************************************************
+	\struct Agent
+	\brief
+		   State of agent other than position and velocity.
+	********************************************************************/
+	struct Agent
+	{
+		float m_radius = 0.f; //!< Radius of agent.
+		float m_maxSpeed = 0.f; //!< The fastest speed of agent.
+		bool m_isActive = false; //!< False if agent has been removed.
+		bool m_isBroken = false; //!< True if corridor was found broken by this update.
+		bool m_needsReplan = false; //!< True if agent waits in queue to find path again. Stands still until then.
+
+		PathCorridor m_corridor; //!< Triangles from position to target.
+		std::vector<Point> m_corners; //!< Next corners of corridor. Found again every update.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Call given function for each active agent, split among
+		   threads of pool.
+
+	\param function
+		   Function takes index of agent and buffer for neighbors.
+	********************************************************************/
+	void ForEachAgent(const std::function<void(int, std::vector<int>&)>& function);
+	/*!*******************************************************************
+	\brief
+		   Compute velocity toward next corner of given agent. Slows down
+		   before target.
+
+	\param agent
+		   Index of agent.
+
+	\param dt
+		   Time of this update.
+
+	\return Vector
+			Velocity agent wants to have.
+	********************************************************************/
+	Vector ComputeDesiredVelocity(int agent, float dt);
+	/*!*******************************************************************
+	\brief
+		   Choose velocity close to desired one among samples, which
+		   does not collide with neighbors soon. Each agent takes half
+		   of the responsibility to avoid other.
+
+	\param agent
+		   Index of agent.
+
+	\param desired
+		   Velocity agent wants to have.
+
+	\param neighbors
+		   Buffer to find neighbors.
+
+	\return Vector
+			Chosen velocity.
+	********************************************************************/
+	Vector SelectVelocity(int agent, const Vector& desired, std::vector<int>& neighbors) const;
+	/*!*******************************************************************
+	\brief
+		   Compute time until two moving circles touch.
+
+	\param position
+		   Position of other circle relative to this one.
+
+	\param velocity
+		   Velocity of this circle relative to other one.
+
+	\param radius
+		   Sum of radius of both circles.
+
+	\return float
+			Time to collide. 0 if they overlap already, and negative
+			if they never collide.
+	********************************************************************/
+	float ComputeTimeToCollision(const Vector& position, const Vector& velocity, float radius) const;
+	/*!*******************************************************************
+	\brief
+		   Find path of given agent to given point, and replace its
+		   corridor.
+
+	\param agent
+		   Index of agent.
+
+	\param target
+		   Destination point.
+
+	\return bool
+			False if there is no path. Agent stays then.
+	********************************************************************/
+	bool Replan(int agent, const Point& target);
+
+private:
+	const NavGraph& m_graph; //!< Graph to walk on. Only read.
+	PathQuery m_query; //!< Query to find path of agents.
+	SpatialHash m_hash; //!< Positions of agents at the beginning of update.
+	ThreadPool m_pool; //!< Threads updating agents. Started once, and woken for each phase of update.
+	std::vector<std::vector<int>> m_neighbors; //!< Buffer to find neighbors for each thread, so updates do not allocate.
+
+	std::vector<Agent> m_agents; //!< All agents including removed ones.
+	std::vector<Point> m_positions; //!< Position of each agent.
+	std::vector<Vector> m_velocities; //!< Velocity of each agent.
+	std::vector<Vector> m_newVelocities; //!< Velocities chosen during update. Written separately, so every agent sees same velocities of others.
+	std::vector<int> m_freeSlots; //!< Index of removed agents.
+	float m_maxRadius = 0.f; //!< The biggest radius among agents.
+	float m_maxSpeed = 0.f; //!< The fastest speed among agents.
+	unsigned m_graphVersion = 0; //!< Version of graph when corridors were checked last time.
+	std::deque<int> m_replans; //!< Agents waiting to find path again, in order of broken corridors. May have removed agents.
+	int m_maxReplans; //!< The biggest number of searches in one update.
+};
+
+#endif // !CROWD_H
\ No newline at end of file
@@ -0,0 +1,252 @@
+/*!*******************************************************************
+\file		  DistanceQuery.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <limits>
+#include <algorithm>
+#include <queue>
+#include <atomic>
+
+#include "DistanceQuery.h"
+
+namespace
+{
+	const float Unreachable = std::numeric_limits<float>::infinity(); //!< Distance of targets cannot be reached.
+}
+
+DistanceQuery::DistanceQuery(const NavGraph& graph, ThreadPool& pool)
+	: m_graph(graph), m_pool(pool), m_workers(pool.GetThreadCount())
+{
+}
+
+void DistanceQuery::SetFilter(const QueryFilter& filter)
+{
+	m_filter = filter;
+}
+
+std::vector<float> DistanceQuery::ComputeMatrix(const std::vector<Point>& sources, const std::vector<Point>& targets)
+{
+	const Targets grouped = GroupTargets(targets);
+	const size_t width = targets.size();
+
+	std::vector<float> distances(sources.size() * width, Unreachable);
+
+	// Each source writes its own row only, so threads do not need lock.
+	ForEachSource(static_cast<int>(sources.size()), [&](Worker& worker, int source) {
+		std::vector<std::pair<float, int>> found;
+		Search(worker, sources[source], grouped, -1, found);
+
+		for (const auto& target : found)
+			distances[source * width + target.second] = target.first;
+	});
+
+	return distances;
+}
+
+std::vector<std::vector<DistanceQuery::Nearest>> DistanceQuery::FindNearest(const std::vector<Point>& sources, const std::vector<Point>& targets, int k)
+{
+	const Targets grouped = GroupTargets(targets);
+
+	std::vector<std::vector<Nearest>> nearest(sources.size());
+	if (k <= 0) return nearest;
+
+	ForEachSource(static_cast<int>(sources.size()), [&](Worker& worker, int source) {
+		std::vector<std::pair<float, int>> found;
+		Search(worker, sources[source], grouped, k, found);
+
+		// Search may find more than k targets before it stops.
+		std::sort(found.begin(), found.end());
+		if (found.size() > static_cast<size_t>(k))
+			found.resize(k);
+
+		auto& result = nearest[source];
+		for (const auto& target : found)
+			result.push_back(Nearest{ target.second, target.first });
+	});
+
+	return nearest;
+}
+
+DistanceQuery::Targets DistanceQuery::GroupTargets(const std::vector<Point>& points) const
+{
+	Targets targets;
+	targets.m_points = &points;
+
+	const int triangleCount = m_graph.GetTriangleCount();
+	const int size = static_cast<int>(points.size());
+
+	// Count targets of each triangle.
+	std::vector<int> triangles(size);
+	targets.m_offsets.assign(triangleCount + 1, 0);
+	targets.m_componentCounts.assign(m_graph.GetComponentCount(), 0);
+
+	for (int i = 0; i < size; ++i)
+	{
+		// Target in excluded area or blocked triangle is never reached, so search does not wait for it.
+		triangles[i] = m_graph.FindTriangle(points[i]);
+		if (triangles[i] >= 0 && (!m_filter.IsIncluded(m_graph.GetArea(triangles[i])) || m_graph.IsBlocked(triangles[i])))
+			triangles[i] = -1;
+
+		if (triangles[i] < 0) continue;
+
+		++targets.m_offsets[triangles[i] + 1];
+		++targets.m_componentCounts[m_graph.GetComponent(triangles[i])];
+		++targets.m_count;
+	}
+
+	for (int i = 0; i < triangleCount; ++i)
+		targets.m_offsets[i + 1] += targets.m_offsets[i];
+
+	// Put each target into range of its triangle.
+	std::vector<int> positions(targets.m_offsets.begin(), targets.m_offsets.end() - 1);
+	targets.m_indices.resize(targets.m_count);
+
+	for (int i = 0; i < size; ++i)
+	{
+		if (triangles[i] >= 0)
+			targets.m_indices[positions[triangles[i]]++] = i;
+	}
+
+	return targets;
+}
+
+void DistanceQuery::ForEachSource(int count, const std::function<void(Worker&, int)>& function)
+{
+	const int threadCount = std::min(static_cast<int>(m_workers.size()), count);
+	const int triangleCount = m_graph.GetTriangleCount();
+
+	for (int i = 0; i < threadCount; ++i)
+	{
+		if (m_workers[i].m_context.GetNodeCount() != triangleCount)
+		{
+			m_workers[i].m_context.Initialize(triangleCount);
+			m_workers[i].m_nodeLinks.assign(triangleCount, -1);
+		}
+	}
+
+	// Threads take next source one by one, so long searches do not make others wait.
+	std::atomic<int> next(0);
+	m_pool.Run(threadCount, [&](int thread) {
+		for (int source = next++; source < count; source = next++)
+			function(m_workers[thread], source);
+	});
+}
+
+void DistanceQuery::Search(Worker& worker, const Point& source, const Targets& targets, int k, std::vector<std::pair<float, int>>& found) const
+{
+	SearchContext& context = worker.m_context;
+
+	const int sourceTriangle = m_graph.FindTriangle(source);
+	if (sourceTriangle < 0 || !m_filter.IsIncluded(m_graph.GetArea(sourceTriangle)) || m_graph.IsBlocked(sourceTriangle)) return;
+
+	// Targets of other components are never reached, so do not wait for them.
+	int remaining = targets.m_componentCounts[m_graph.GetComponent(sourceTriangle)];
+	if (remaining == 0) return;
+
+	const auto& points = *targets.m_points;
+
+	// The k nearest targets so far. Farthest one is on the top.
+	std::priority_queue<std::pair<float, int>> nearest;
+
+	context.Clear();
+	context.Open(sourceTriangle, -1, SearchContext::NoPortal, 0.f, 0.f);
+
+	while (!context.IsOpenListEmpty())
+	{
+		const int triangle = context.Close();
+		const SearchNode& thisNode = context.GetNode(triangle);
+		const Point& origin = GetOrigin(worker, triangle, source);
+
+		// Distance inside of this triangle costs as its area.
+		const float multiplier = m_filter.GetCost(m_graph.GetArea(triangle));
+
+		// Every target left is farther than given cost. Enough nearest targets are found already.
+		if (k >= 0 && static_cast<int>(nearest.size()) == k && thisNode.m_given >= nearest.top().first)
+			return;
+
+		// Settle targets inside of this triangle. Triangle is convex, so straight line from origin is the shortest.
+		for (int i = targets.m_offsets[triangle]; i < targets.m_offsets[triangle + 1]; ++i)
+		{
+			const int target = targets.m_indices[i];
+			const float distance = thisNode.m_given + DistanceBetween(origin, points[target]) * multiplier;
+
+			found.push_back(std::make_pair(distance, target));
+			--remaining;
+
+			if (k >= 0)
+			{
+				nearest.push(std::make_pair(distance, target));
+				if (static_cast<int>(nearest.size()) > k)
+					nearest.pop();
+			}
+		}
+
+		if (remaining == 0)
+			return;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			// Walls have area no filter includes, so this skips walls and excluded areas at once.
+			if (!m_filter.IsIncluded(m_graph.GetNeighborArea(triangle, i))) continue;
+
+			const int neighbor = m_graph.GetNeighbor(triangle, i);
+			if (m_graph.IsBlocked(neighbor)) continue;
+
+			const auto status = context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed) continue;
+
+			const float new_given = thisNode.m_given + DistanceBetween(m_graph.GetMidpoint(triangle, i), origin) * multiplier;
+
+			if (status == SearchNode::Status::Default || new_given < context.GetNode(neighbor).m_given)
+				context.Open(neighbor, triangle, m_graph.GetTwin(triangle, i), new_given, new_given);
+		}
+
+		// Off-mesh links are rare, so flag in hot data is checked before side table.
+		if (!m_graph.HasLinks(triangle) || !m_filter.AreOffMeshLinksIncluded()) continue;
+
+		const int count = m_graph.GetLinkCount(triangle);
+		for (int i = 0; i < count; ++i)
+		{
+			const int link = m_graph.GetLink(triangle, i);
+			const auto& offMeshLink = m_graph.GetOffMeshLink(link);
+
+			// Search goes from source, so agent must leave this triangle by the link.
+			const bool isReversed = offMeshLink.m_startTriangle != triangle;
+			if (isReversed && !offMeshLink.m_isBidirectional) continue;
+
+			const int neighbor = isReversed ? offMeshLink.m_startTriangle : offMeshLink.m_endTriangle;
+			if (!m_filter.IsIncluded(m_graph.GetArea(neighbor)) || m_graph.IsBlocked(neighbor)) continue;
+
+			const auto status = context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed) continue;
+
+			// Agent walks from origin of this node to where link departs, then pays for the link.
+			const Point& departure = isReversed ? offMeshLink.m_end : offMeshLink.m_start;
+			const float new_given = thisNode.m_given + DistanceBetween(departure, origin) * multiplier + offMeshLink.m_cost;
+
+			if (status == SearchNode::Status::Default || new_given < context.GetNode(neighbor).m_given)
+			{
+				context.Open(neighbor, triangle, SearchContext::LinkPortal, new_given, new_given);
+				worker.m_nodeLinks[neighbor] = link * 2 + (isReversed ? 1 : 0);
+			}
+		}
+	}
+}
+
+const Point& DistanceQuery::GetOrigin(const Worker& worker, int triangle, const Point& source) const
+{
+	const SearchNode& node = worker.m_context.GetNode(triangle);
+	if (node.m_parent < 0)
+		return source;
+
+	// Node reached by off-mesh link starts where the link arrives.
+	if (node.m_portal == SearchContext::LinkPortal)
+	{
+		const auto& offMeshLink = m_graph.GetOffMeshLink(worker.m_nodeLinks[triangle] / 2);
+		return worker.m_nodeLinks[triangle] % 2 != 0 ? offMeshLink.m_start : offMeshLink.m_end;
+	}
+
+	return m_graph.GetMidpoint(triangle, node.m_portal);
+}
\ No newline at end of file
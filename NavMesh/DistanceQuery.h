@@ -0,0 +1,206 @@
+/*!*******************************************************************
+\headerfile   DistanceQuery.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for DistanceQuery class which computes path
+			  distances between many sources and many targets.
+********************************************************************/
+#ifndef DISTANCEQUERY_H
+#define DISTANCEQUERY_H
+
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "QueryFilter.h"
+#include "SearchContext.h"
+#include "ThreadPool.h"
+
+/*!*******************************************************************
+\class DistanceQuery
+\brief
+	   Batch of path distance queries. Runs one Dijkstra for each
+	   source, which stops as soon as every target it cares about is
+	   settled. Sources are split among threads of pool.
+	   Distances follow middle points of portals and off-mesh links,
+	   and are weighted by cost of areas of filter, same as A* query.
+********************************************************************/
+class DistanceQuery
+{
+public:
+	/*!*******************************************************************
+	\struct Nearest
+	\brief
+		   One of the nearest targets from a source.
+	********************************************************************/
+	struct Nearest
+	{
+		int m_target; //!< Index of target.
+		float m_distance; //!< Path cost from the source.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Constructor that sets graph and threads.
+
+	\param graph
+		   Graph to search on. Must not be moved while this query uses
+		   it, nor changed during a batch. Blocked triangles are never
+		   entered, so points inside of them are unreachable.
+
+	\param pool
+		   Threads searching at once, shared with other systems like
+		   crowd. Must live longer than this query. Batches are run
+		   from the thread calling them, so it must be the thread
+		   other users of pool run from.
+	********************************************************************/
+	DistanceQuery(const NavGraph& graph, ThreadPool& pool);
+
+	/*!*******************************************************************
+	\brief
+		   Setter method for filter deciding cost and passability of
+		   area types. Points in excluded areas are unreachable.
+
+	\param filter
+		   New filter. Copied.
+	********************************************************************/
+	void SetFilter(const QueryFilter& filter);
+
+	/*!*******************************************************************
+	\brief
+		   Compute path distance from every source to every target.
+
+	\param sources
+		   Start points.
+
+	\param targets
+		   End points.
+
+	\return std::vector<float>
+			Costs in row-major order. Cost from source i to target j
+			is at i * targets.size() + j. Infinity if unreachable or
+			one of points is not inside of polygon.
+	********************************************************************/
+	std::vector<float> ComputeMatrix(const std::vector<Point>& sources, const std::vector<Point>& targets);
+	/*!*******************************************************************
+	\brief
+		   Find k nearest targets by path distance from every source.
+
+	\param sources
+		   Start points.
+
+	\param targets
+		   End points.
+
+	\param k
+		   The number of targets to find for each source.
+
+	\return std::vector<std::vector<Nearest>>
+			Nearest targets of each source, from nearest one. Can have
+			less than k if there are not enough reachable targets.
+	********************************************************************/
+	std::vector<std::vector<Nearest>> FindNearest(const std::vector<Point>& sources, const std::vector<Point>& targets, int k);
+
+private:
+	/*!*******************************************************************
+	\struct Targets
+	\brief
+		   Targets grouped by triangle including them, so searching can
+		   check whether closed triangle has targets at once.
+	********************************************************************/
+	struct Targets
+	{
+		const std::vector<Point>* m_points = nullptr; //!< Position of targets.
+		std::vector<int> m_offsets; //!< Targets of triangle i are from m_indices[m_offsets[i]] to m_indices[m_offsets[i + 1]].
+		std::vector<int> m_indices; //!< Index of targets sorted by triangle.
+		int m_count = 0; //!< The number of targets inside of polygon and included areas.
+		std::vector<int> m_componentCounts; //!< The number of targets in each connected component. Search stops once all of its component are found.
+	};
+
+	/*!*******************************************************************
+	\struct Worker
+	\brief
+		   Everything one thread writes during search.
+	********************************************************************/
+	struct Worker
+	{
+		SearchContext m_context; //!< Nodes and open list for Dijkstra.
+		std::vector<int> m_nodeLinks; //!< Off-mesh link each node was reached by, times 2, plus 1 if reversed. Only valid for nodes of LinkPortal.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Group given targets by triangle.
+
+	\param points
+		   Position of targets.
+
+	\return Targets
+			Grouped targets.
+	********************************************************************/
+	Targets GroupTargets(const std::vector<Point>& points) const;
+	/*!*******************************************************************
+	\brief
+		   Call given function for each source, split among threads of
+		   pool. Each thread uses its own worker.
+
+	\param count
+		   The number of sources.
+
+	\param function
+		   Function takes worker and index of source.
+	********************************************************************/
+	void ForEachSource(int count, const std::function<void(Worker&, int)>& function);
+	/*!*******************************************************************
+	\brief
+		   Run Dijkstra from given source until targets are settled.
+
+	\param worker
+		   Worker of thread running this search.
+
+	\param source
+		   Start point.
+
+	\param targets
+		   Grouped targets.
+
+	\param k
+		   Stops once it is sure k nearest targets are found. If it is
+		   negative, stops after all targets are found.
+
+	\param found
+		   Pairs of distance and index of target found. Not sorted.
+	********************************************************************/
+	void Search(Worker& worker, const Point& source, const Targets& targets, int k, std::vector<std::pair<float, int>>& found) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for point where path enters given node.
+
+	\param worker
+		   Worker of thread running the search.
+
+	\param triangle
+		   Index of node. Must be visited by the search.
+
+	\param source
+		   Start point of the search.
+
+	\return const Point&
+			Source for the root, arrival point for node reached by
+			off-mesh link, middle point of portal for others.
+	********************************************************************/
+	const Point& GetOrigin(const Worker& worker, int triangle, const Point& source) const;
+
+private:
+	const NavGraph& m_graph; //!< Graph shared by all threads. Only read.
+	ThreadPool& m_pool; //!< Threads running searches. Owned by user of this query.
+	QueryFilter m_filter; //!< Cost and passability of area types.
+	std::vector<Worker> m_workers; //!< Worker for each thread. Reused for every batch.
+};
+
+#endif // !DISTANCEQUERY_H
\ No newline at end of file
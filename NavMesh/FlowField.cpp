@@ -0,0 +1,323 @@
+/*!*******************************************************************
+\file		  FlowField.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <limits>
+
+#include "FlowField.h"
+
+namespace
+{
+	const float Unreachable = std::numeric_limits<float>::infinity(); //!< Distance of triangles cannot reach the goal.
+}
+
+void FlowField::Initialize(const NavGraph& graph)
+{
+	m_graph = &graph;
+
+	const int size = graph.GetTriangleCount();
+	m_context.Initialize(size);
+
+	// Seeds of links are added by goal triangle which has them.
+	m_seeds.assign(3, Seed());
+	for (auto& seed : m_seeds)
+		InitializeSeed(seed);
+
+	m_distances.assign(size, Unreachable);
+	m_portals.assign(size, SearchContext::NoPortal);
+	m_nodeLinks.assign(size, -1);
+	m_goalTriangle = -1;
+}
+
+void FlowField::SetFilter(const QueryFilter& filter)
+{
+	m_filter = filter;
+
+	// Every seed is computed again by the next goal.
+	m_goalTriangle = -1;
+}
+
+bool FlowField::SetGoal(const Point& goal)
+{
+	const int triangle = m_graph ? m_graph->FindTriangle(goal) : -1;
+	m_goal = goal;
+
+	// Special case. Goal is not inside of polygon, or in excluded area or blocked triangle.
+	if (triangle < 0 || !m_filter.IsIncluded(m_graph->GetArea(triangle)) || m_graph->IsBlocked(triangle))
+	{
+		if (m_graph)
+			m_version = m_graph->GetVersion();
+
+		m_goalTriangle = -1;
+		m_distances.assign(m_distances.size(), Unreachable);
+		m_portals.assign(m_portals.size(), SearchContext::NoPortal);
+		return false;
+	}
+
+	// Goal moved into other triangle, or graph changed. Paths from each edge and link change.
+	if (triangle != m_goalTriangle || m_version != m_graph->GetVersion())
+	{
+		m_goalTriangle = triangle;
+		m_version = m_graph->GetVersion();
+		AddLinkSeeds();
+
+		for (int i = 0; i < static_cast<int>(m_seeds.size()); ++i)
+			ComputeSeed(i);
+	}
+
+	Combine();
+	return true;
+}
+
+const Point& FlowField::GetGoal() const
+{
+	return m_goal;
+}
+
+int FlowField::GetGoalTriangle() const
+{
+	return m_goalTriangle;
+}
+
+unsigned FlowField::GetGraphVersion() const
+{
+	return m_version;
+}
+
+bool FlowField::IsReachable(int triangle) const
+{
+	return m_distances[triangle] != Unreachable;
+}
+
+float FlowField::GetDistance(int triangle) const
+{
+	return m_distances[triangle];
+}
+
+float FlowField::GetDistance(int triangle, const Point& position) const
+{
+	if (!IsReachable(triangle))
+		return Unreachable;
+
+	return DistanceBetween(position, GetNextWaypoint(triangle)) * m_filter.GetCost(m_graph->GetArea(triangle)) + m_distances[triangle];
+}
+
+int FlowField::GetNextTriangle(int triangle) const
+{
+	if (triangle == m_goalTriangle || !IsReachable(triangle))
+		return -1;
+
+	const int portal = m_portals[triangle];
+	if (portal == SearchContext::LinkPortal)
+	{
+		const auto& offMeshLink = m_graph->GetOffMeshLink(m_nodeLinks[triangle] / 2);
+		return m_nodeLinks[triangle] % 2 != 0 ? offMeshLink.m_startTriangle : offMeshLink.m_endTriangle;
+	}
+
+	return m_graph->GetNeighbor(triangle, portal);
+}
+
+const Point& FlowField::GetNextWaypoint(int triangle) const
+{
+	if (triangle == m_goalTriangle || !IsReachable(triangle))
+		return m_goal;
+
+	return GetWaypoint(m_portals[triangle], m_nodeLinks[triangle], triangle);
+}
+
+int FlowField::GetNextLink(int triangle) const
+{
+	if (triangle == m_goalTriangle || !IsReachable(triangle) || m_portals[triangle] != SearchContext::LinkPortal)
+		return -1;
+
+	return m_nodeLinks[triangle] / 2;
+}
+
+void FlowField::InitializeSeed(Seed& seed) const
+{
+	const int size = m_graph->GetTriangleCount();
+
+	seed.m_distances.assign(size, Unreachable);
+	seed.m_portals.assign(size, SearchContext::NoPortal);
+	seed.m_nodeLinks.assign(size, -1);
+}
+
+void FlowField::AddLinkSeeds()
+{
+	m_seeds.resize(3);
+
+	if (!m_graph->HasLinks(m_goalTriangle) || !m_filter.AreOffMeshLinksIncluded())
+		return;
+
+	const int count = m_graph->GetLinkCount(m_goalTriangle);
+	for (int i = 0; i < count; ++i)
+	{
+		const int link = m_graph->GetLink(m_goalTriangle, i);
+		const auto& offMeshLink = m_graph->GetOffMeshLink(link);
+
+		// Agent must arrive at goal triangle by the link.
+		const bool isReversed = offMeshLink.m_endTriangle != m_goalTriangle;
+		if (isReversed && !offMeshLink.m_isBidirectional) continue;
+
+		// Link inside of goal triangle never helps, since agents there go straight to the goal.
+		const int departure = isReversed ? offMeshLink.m_endTriangle : offMeshLink.m_startTriangle;
+		if (departure == m_goalTriangle) continue;
+
+		m_seeds.emplace_back();
+		m_seeds.back().m_link = link * 2 + (isReversed ? 1 : 0);
+		InitializeSeed(m_seeds.back());
+	}
+}
+
+const Point& FlowField::GetWaypoint(int portal, int nodeLink, int triangle) const
+{
+	// Agent reached by off-mesh link heads to where the link departs.
+	if (portal == SearchContext::LinkPortal)
+	{
+		const auto& offMeshLink = m_graph->GetOffMeshLink(nodeLink / 2);
+		return nodeLink % 2 != 0 ? offMeshLink.m_end : offMeshLink.m_start;
+	}
+
+	return m_graph->GetMidpoint(triangle, portal);
+}
+
+void FlowField::ComputeSeed(int index)
+{
+	auto& seed = m_seeds[index];
+	seed.m_distances.assign(seed.m_distances.size(), Unreachable);
+	seed.m_portals.assign(seed.m_portals.size(), SearchContext::NoPortal);
+
+	m_context.Clear();
+
+	if (seed.m_link >= 0)
+	{
+		// Root is the triangle link departs from, starting from where it departs.
+		const auto& offMeshLink = m_graph->GetOffMeshLink(seed.m_link / 2);
+		const int first = seed.m_link % 2 != 0 ? offMeshLink.m_endTriangle : offMeshLink.m_startTriangle;
+		if (!m_filter.IsIncluded(m_graph->GetArea(first)) || m_graph->IsBlocked(first)) return;
+
+		m_context.Open(first, -1, SearchContext::LinkPortal, 0.f, 0.f);
+		seed.m_nodeLinks[first] = seed.m_link;
+	}
+	else
+	{
+		// Wall, excluded area or blocked triangle. Nothing can come through this edge.
+		if (!m_filter.IsIncluded(m_graph->GetNeighborArea(m_goalTriangle, index))) return;
+
+		// Root is the neighbor across the edge, starting from middle point of the edge.
+		const int first = m_graph->GetNeighbor(m_goalTriangle, index);
+		if (m_graph->IsBlocked(first)) return;
+
+		m_context.Open(first, -1, m_graph->GetTwin(m_goalTriangle, index), 0.f, 0.f);
+	}
+
+	while (!m_context.IsOpenListEmpty())
+	{
+		const int triangle = m_context.Close();
+		const SearchNode& thisNode = m_context.GetNode(triangle);
+		const Point& origin = GetWaypoint(thisNode.m_portal, seed.m_nodeLinks[triangle], triangle);
+
+		seed.m_distances[triangle] = thisNode.m_given;
+		seed.m_portals[triangle] = static_cast<unsigned char>(thisNode.m_portal);
+
+		// Agent from neighbor crosses this triangle to origin, so distance costs as area of this triangle.
+		const float multiplier = m_filter.GetCost(m_graph->GetArea(triangle));
+
+		for (int i = 0; i < 3; ++i)
+		{
+			// Walls have area no filter includes, so this skips walls and excluded areas at once.
+			if (!m_filter.IsIncluded(m_graph->GetNeighborArea(triangle, i))) continue;
+
+			// Paths through goal triangle are covered by other edges.
+			const int neighbor = m_graph->GetNeighbor(triangle, i);
+			if (neighbor == m_goalTriangle || m_graph->IsBlocked(neighbor)) continue;
+
+			const auto status = m_context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed) continue;
+
+			const float new_given = thisNode.m_given + DistanceBetween(m_graph->GetMidpoint(triangle, i), origin) * multiplier;
+
+			if (status == SearchNode::Status::Default || new_given < m_context.GetNode(neighbor).m_given)
+				m_context.Open(neighbor, triangle, m_graph->GetTwin(triangle, i), new_given, new_given);
+		}
+
+		// Off-mesh links are rare, so flag in hot data is checked before side table.
+		if (!m_graph->HasLinks(triangle) || !m_filter.AreOffMeshLinksIncluded()) continue;
+
+		const int count = m_graph->GetLinkCount(triangle);
+		for (int i = 0; i < count; ++i)
+		{
+			const int link = m_graph->GetLink(triangle, i);
+			const auto& offMeshLink = m_graph->GetOffMeshLink(link);
+
+			// Search goes from goal, so agent must arrive at this triangle by the link.
+			const bool isReversed = offMeshLink.m_endTriangle != triangle;
+			if (isReversed && !offMeshLink.m_isBidirectional) continue;
+
+			const int neighbor = isReversed ? offMeshLink.m_endTriangle : offMeshLink.m_startTriangle;
+			if (neighbor == m_goalTriangle || !m_filter.IsIncluded(m_graph->GetArea(neighbor)) || m_graph->IsBlocked(neighbor)) continue;
+
+			const auto status = m_context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed) continue;
+
+			// Agent pays for the link, then walks from where it arrives to origin of this node.
+			const Point& arrival = isReversed ? offMeshLink.m_start : offMeshLink.m_end;
+			const float new_given = thisNode.m_given + DistanceBetween(arrival, origin) * multiplier + offMeshLink.m_cost;
+
+			if (status == SearchNode::Status::Default || new_given < m_context.GetNode(neighbor).m_given)
+			{
+				m_context.Open(neighbor, triangle, SearchContext::LinkPortal, new_given, new_given);
+				seed.m_nodeLinks[neighbor] = link * 2 + (isReversed ? 1 : 0);
+			}
+		}
+	}
+}
+
+void FlowField::Combine()
+{
+	// Cost from middle point of each edge of goal triangle, or from each link departing toward it, to goal.
+	const float multiplier = m_filter.GetCost(m_graph->GetArea(m_goalTriangle));
+	const int seedCount = static_cast<int>(m_seeds.size());
+
+	std::vector<float> offsets(seedCount);
+	for (int i = 0; i < seedCount; ++i)
+	{
+		const int link = m_seeds[i].m_link;
+		if (link < 0)
+		{
+			offsets[i] = DistanceBetween(m_goal, m_graph->GetMidpoint(m_goalTriangle, i)) * multiplier;
+			continue;
+		}
+
+		const auto& offMeshLink = m_graph->GetOffMeshLink(link / 2);
+		const Point& arrival = link % 2 != 0 ? offMeshLink.m_start : offMeshLink.m_end;
+		offsets[i] = DistanceBetween(m_goal, arrival) * multiplier + offMeshLink.m_cost;
+	}
+
+	const int size = static_cast<int>(m_distances.size());
+	for (int i = 0; i < size; ++i)
+	{
+		float best = Unreachable;
+		int bestSeed = -1;
+
+		for (int j = 0; j < seedCount; ++j)
+		{
+			const float distance = m_seeds[j].m_distances[i] + offsets[j];
+			if (distance < best)
+			{
+				best = distance;
+				bestSeed = j;
+			}
+		}
+
+		m_distances[i] = best;
+		m_portals[i] = bestSeed < 0 ? static_cast<unsigned char>(SearchContext::NoPortal) : m_seeds[bestSeed].m_portals[i];
+		m_nodeLinks[i] = bestSeed < 0 ? -1 : m_seeds[bestSeed].m_nodeLinks[i];
+	}
+
+	// Agents inside of goal triangle go straight to the goal.
+	m_distances[m_goalTriangle] = 0.f;
+	m_portals[m_goalTriangle] = SearchContext::NoPortal;
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+/*!*******************************************************************
+\headerfile   FlowField.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for FlowField class which stores direction
+			  toward one goal for every triangle.
+********************************************************************/
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include <vector>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "QueryFilter.h"
+#include "SearchContext.h"
+
+/*!*******************************************************************
+\class FlowField
+\brief
+	   Cost to the goal and the next portal for every triangle,
+	   computed by Dijkstra from the goal. Cost is distance times
+	   cost of area of filter, same as A* query. Many agents heading to the
+	   same goal read their next waypoint from here instead of
+	   searching each.
+	   Dijkstra runs once for each edge of the goal triangle and each
+	   off-mesh link arriving at it, so moving the goal inside of the
+	   same triangle only combines stored results without searching
+	   again.
+********************************************************************/
+class FlowField
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Set graph to compute on. Graph must not be moved while this
+		   field uses it, nor changed during SetGoal. Blocking triangles
+		   between calls only makes the field stale until next SetGoal.
+
+	\param graph
+		   Graph of navigation meshes of current map.
+	********************************************************************/
+	void Initialize(const NavGraph& graph);
+	/*!*******************************************************************
+	\brief
+		   Setter method for filter deciding cost and passability of
+		   area types. Used from the next SetGoal, which computes
+		   every triangle again. Excluded triangles are unreachable.
+
+	\param filter
+		   New filter. Copied.
+	********************************************************************/
+	void SetFilter(const QueryFilter& filter);
+
+	/*!*******************************************************************
+	\brief
+		   Setter method for goal. Computes distances and portals of all
+		   triangles. Searches again if graph changed since the last
+		   goal, even in the same triangle.
+
+	\param goal
+		   Point all agents are heading to.
+
+	\return bool
+			False if goal is not inside of polygon, or is in excluded
+			area or blocked triangle. Every triangle is unreachable
+			then.
+	********************************************************************/
+	bool SetGoal(const Point& goal);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for goal.
+
+	\return const Point&
+			Point all agents are heading to.
+	********************************************************************/
+	const Point& GetGoal() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for triangle including goal.
+
+	\return int
+			Index of the triangle. -1 if goal is not inside of polygon.
+	********************************************************************/
+	int GetGoalTriangle() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for version of graph the field was computed on.
+		   If it differs from NavGraph::GetVersion, portals may lead
+		   into blocked triangles, and the next SetGoal computes again.
+
+	\return unsigned
+			Version of graph of the last SetGoal.
+	********************************************************************/
+	unsigned GetGraphVersion() const;
+	/*!*******************************************************************
+	\brief
+		   Check whether goal can be reached from given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\return bool
+			True if there is a path to the goal.
+	********************************************************************/
+	bool IsReachable(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for cost from next waypoint of given triangle
+		   to the goal.
+
+	\param triangle
+		   Index of triangle.
+
+	\return float
+			Cost along portals. Infinity if goal is unreachable.
+	********************************************************************/
+	float GetDistance(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Compute cost from given position inside of given triangle to
+		   the goal.
+
+	\param triangle
+		   Index of triangle including position.
+
+	\param position
+		   Position of agent.
+
+	\return float
+			Cost along portals. Infinity if goal is unreachable.
+	********************************************************************/
+	float GetDistance(int triangle, const Point& position) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for triangle agent in given triangle moves into.
+
+	\param triangle
+		   Index of triangle.
+
+	\return int
+			Index of next triangle. -1 for the goal triangle or if goal
+			is unreachable.
+	********************************************************************/
+	int GetNextTriangle(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for point agent in given triangle moves toward.
+
+	\param triangle
+		   Index of triangle. Goal must be reachable from it.
+
+	\return const Point&
+			Middle point of the next portal, start point of the next
+			off-mesh link, or goal for the goal triangle.
+	********************************************************************/
+	const Point& GetNextWaypoint(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for off-mesh link agent in given triangle takes
+		   after reaching its next waypoint.
+
+	\param triangle
+		   Index of triangle.
+
+	\return int
+			Index of off-mesh link. -1 if agent walks through a portal,
+			is in the goal triangle or goal is unreachable.
+	********************************************************************/
+	int GetNextLink(int triangle) const;
+
+private:
+	/*!*******************************************************************
+	\struct Seed
+	\brief
+		   Result of Dijkstra started from one edge of goal triangle, or
+		   from one off-mesh link arriving at it.
+		   Paths never go back into goal triangle.
+	********************************************************************/
+	struct Seed
+	{
+		std::vector<float> m_distances; //!< Cost from middle point of the edge, or start of the link, to next waypoint of each triangle.
+		std::vector<unsigned char> m_portals; //!< Edge of each triangle toward the seed edge. LinkPortal if agent takes off-mesh link.
+		std::vector<int> m_nodeLinks; //!< Off-mesh link of each triangle, times 2, plus 1 if reversed. Only valid for LinkPortal.
+		int m_link = -1; //!< Off-mesh link this seed starts from, times 2, plus 1 if reversed. -1 for seeds of edges.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Size containers of given seed for current graph.
+
+	\param seed
+		   Seed to initialize.
+	********************************************************************/
+	void InitializeSeed(Seed& seed) const;
+	/*!*******************************************************************
+	\brief
+		   Keep seeds of edges and add one seed for each off-mesh link
+		   arriving at goal triangle.
+	********************************************************************/
+	void AddLinkSeeds();
+	/*!*******************************************************************
+	\brief
+		   Getter method for point agent heads to, by portal and
+		   off-mesh link stored for given triangle.
+
+	\param portal
+		   Edge toward the goal, or LinkPortal.
+
+	\param nodeLink
+		   Off-mesh link, times 2, plus 1 if reversed. Only used for
+		   LinkPortal.
+
+	\param triangle
+		   Index of triangle.
+
+	\return const Point&
+			Middle point of the portal, or start point of the link.
+	********************************************************************/
+	const Point& GetWaypoint(int portal, int nodeLink, int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Run Dijkstra from root of given seed and store the result.
+
+	\param index
+		   Index of seed. Same as index of edge of goal triangle for
+		   the first three.
+	********************************************************************/
+	void ComputeSeed(int index);
+	/*!*******************************************************************
+	\brief
+		   Choose the best edge of goal triangle for every triangle with
+		   current goal.
+	********************************************************************/
+	void Combine();
+
+private:
+	const NavGraph* m_graph = nullptr; //!< Graph to compute on. Owned by user of this field.
+	SearchContext m_context; //!< Nodes and open list for Dijkstra.
+	QueryFilter m_filter; //!< Cost and passability of area types.
+
+	std::vector<Seed> m_seeds; //!< Results for each edge of goal triangle, then for each off-mesh link arriving at it.
+	std::vector<float> m_distances; //!< Cost from next waypoint of each triangle to the goal.
+	std::vector<unsigned char> m_portals; //!< Edge of each triangle to move through. LinkPortal for off-mesh link, which is same as NoPortal of goal triangle and unreachable ones.
+	std::vector<int> m_nodeLinks; //!< Off-mesh link of each triangle, times 2, plus 1 if reversed. Only valid for LinkPortal.
+
+	Point m_goal; //!< Point all agents are heading to.
+	int m_goalTriangle = -1; //!< Triangle including goal.
+	unsigned m_version = 0; //!< Version of graph when seeds were computed.
+};
+
+#endif // !FLOWFIELD_H
\ No newline at end of file
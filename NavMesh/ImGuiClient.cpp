@@ -30,7 +30,7 @@ void ImGuiClient::ProcessEvent(SDL_Event* event)
 	ImGui_ImplSDL2_ProcessEvent(event);
 }
 
-ImGuiClient::Event ImGuiClient::Draw(SDL_Window* window, bool& editMode, bool& showAllNodes, float& weight, Color(&color)[4], bool& smoothPath)
+ImGuiClient::Event ImGuiClient::Draw(SDL_Window* window, bool& editMode, bool& showAllNodes, float& weight, float& radius, Color(&color)[4], bool& smoothPath)
 {
 	Event event = Event::None;
 
@@ -48,9 +48,16 @@ ImGuiClient::Event ImGuiClient::Draw(SDL_Window* window, bool& editMode, bool& s
 	ImGui::Text("Left Mouse Click: Set start point");
 	ImGui::Text("Right Mouse Click: Set end point");
 
+	// Meshes are generated again after edit mode, so points are picked only outside of it.
+	if (!editMode && ImGui::Button("Random Points"))
+		event = Event::RandomPointsPressed;
+
 	if (ImGui::SliderFloat("Weight", &weight, 0.f, 2.f))
 		event = Event::WeightChanged;
 
+	if (ImGui::SliderFloat("Agent radius", &radius, 0.f, 30.f))
+		event = Event::RadiusChanged;
+
 	ImGui::Checkbox("Path smoothing", &smoothPath);
 	ImGui::Checkbox("Show all nodes considered", &showAllNodes);
 
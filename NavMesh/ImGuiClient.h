@@ -36,7 +36,9 @@ public:
 	{
 		AddHole,
 		EditModePressed,
+		RandomPointsPressed,
 		WeightChanged,
+		RadiusChanged,
 		ConsideredColorChanged,
 		VisitedColorChanged,
 		PathColorChanged,
@@ -93,6 +95,9 @@ public:
 	\param weight
 		   Where value of related ImGui float slider will be stored.
 
+	\param radius
+		   Where value of related ImGui float slider will be stored.
+
 	\param color
 		   Where value of related ImGui color editor will be stored.
 
@@ -102,7 +107,7 @@ public:
 	\return Point
 			Mouse position in viewport space.
 	********************************************************************/
-	Event Draw(SDL_Window* window, bool& editMode, bool& showAllNodes, float& weight, Color (&color)[4], bool& smoothPath);
+	Event Draw(SDL_Window* window, bool& editMode, bool& showAllNodes, float& weight, float& radius, Color (&color)[4], bool& smoothPath);
 	/*!*******************************************************************
 	\brief
 		   Abstracted method to call ImGui RenderDrawData function.
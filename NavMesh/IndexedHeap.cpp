@@ -0,0 +1,117 @@
+/*!*******************************************************************
+\file		  IndexedHeap.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include "IndexedHeap.h"
+
+void IndexedHeap::Insert(int node, float cost)
+{
+	// Positions grow with the biggest node seen, so heap does not need the number of nodes.
+	if (node >= static_cast<int>(m_positions.size()))
+		m_positions.resize(node + 1);
+
+	m_entries.push_back(Entry{ cost, node });
+	SiftUp(static_cast<int>(m_entries.size()) - 1);
+}
+
+int IndexedHeap::GetTop()
+{
+	const int node = m_entries[0].m_node;
+
+	// Last entry fills the root, and sinks to its place.
+	const Entry last = m_entries.back();
+	m_entries.pop_back();
+
+	if (!m_entries.empty())
+	{
+		Place(0, last);
+		SiftDown(0);
+	}
+
+	return node;
+}
+
+float IndexedHeap::GetTopCost() const
+{
+	return m_entries[0].m_cost;
+}
+
+void IndexedHeap::DecreaseKey(int node, float /*cost*/, float new_cost)
+{
+	const int index = m_positions[node];
+
+	m_entries[index].m_cost = new_cost;
+	SiftUp(index);
+}
+
+bool IndexedHeap::Empty() const
+{
+	return m_entries.empty();
+}
+
+int IndexedHeap::Size() const
+{
+	return static_cast<int>(m_entries.size());
+}
+
+void IndexedHeap::Clear()
+{
+	m_entries.clear();
+}
+
+void IndexedHeap::Rebuild(const std::function<float(int)>& computeCost)
+{
+	for (auto& entry : m_entries)
+		entry.m_cost = computeCost(entry.m_node);
+
+	// Sift down from the last parent to the root. Linear time.
+	for (int i = static_cast<int>(m_entries.size()) / 2 - 1; i >= 0; --i)
+		SiftDown(i);
+}
+
+void IndexedHeap::SiftUp(int index)
+{
+	const Entry entry = m_entries[index];
+
+	while (index > 0)
+	{
+		const int parent = (index - 1) / 2;
+		if (m_entries[parent].m_cost <= entry.m_cost) break;
+
+		Place(index, m_entries[parent]);
+		index = parent;
+	}
+
+	Place(index, entry);
+}
+
+void IndexedHeap::SiftDown(int index)
+{
+	const Entry entry = m_entries[index];
+	const int size = static_cast<int>(m_entries.size());
+
+	while (true)
+	{
+		// Smaller child of this entry.
+		int child = index * 2 + 1;
+		if (child >= size) break;
+
+		if (child + 1 < size && m_entries[child + 1].m_cost < m_entries[child].m_cost)
+			++child;
+
+		if (entry.m_cost <= m_entries[child].m_cost) break;
+
+		Place(index, m_entries[child]);
+		index = child;
+	}
+
+	Place(index, entry);
+}
+
+void IndexedHeap::Place(int index, const Entry& entry)
+{
+	m_entries[index] = entry;
+	m_positions[entry.m_node] = index;
+}
\ No newline at end of file
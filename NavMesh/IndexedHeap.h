@@ -0,0 +1,152 @@
+/*!*******************************************************************
+\headerfile   IndexedHeap.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for IndexedHeap class being used as open
+			  list for A* algorithm instead of BinaryHeap.
+********************************************************************/
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <vector>
+#include <functional>
+
+/*!*******************************************************************
+\class IndexedHeap
+\brief
+	   Binary min-heap in an array, with position of each node kept
+	   aside. Insert, removing top and decreasing key take
+	   logarithmic time, instead of shifting sorted array like
+	   BinaryHeap. Has same methods as BinaryHeap, so either one can
+	   be open list of BasicSearchContext.
+********************************************************************/
+class IndexedHeap
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Push new node and move it up to its place.
+
+	\param node
+		   Index of new node to insert. Must not be already in the
+		   container.
+
+	\param cost
+		   Cost of new node.
+	********************************************************************/
+	void Insert(int node, float cost);
+	/*!*******************************************************************
+	\brief
+		   Return node has the lowest cost and delete that from the
+		   container.
+
+	\return int
+			Index of node has the lowest cost.
+	********************************************************************/
+	int GetTop();
+	/*!*******************************************************************
+	\brief
+		   Return the lowest cost without removing the node.
+		   Container must not be empty.
+
+	\return float
+			Cost of the root of the heap.
+	********************************************************************/
+	float GetTopCost() const;
+	/*!*******************************************************************
+	\brief
+		   Update given node with lower cost and move it up.
+
+	\param node
+		   Index of node to update. Must be in the container already.
+
+	\param cost
+		   Current cost of given node. Not needed to find it, but kept
+		   same as BinaryHeap.
+
+	\param new_cost
+		   New cost of given node.
+	********************************************************************/
+	void DecreaseKey(int node, float cost, float new_cost);
+	/*!*******************************************************************
+	\brief
+		   Telling whether container is empty or not.
+
+	\return bool
+			If there is no element in the container, returns true.
+			Otherwise, return false.
+	********************************************************************/
+	bool Empty() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of nodes in the container.
+
+	\return int
+			The number of nodes.
+	********************************************************************/
+	int Size() const;
+	/*!*******************************************************************
+	\brief
+		   Remove all nodes from the container.
+	********************************************************************/
+	void Clear();
+	/*!*******************************************************************
+	\brief
+		   Recompute cost of every node in the container and make heap
+		   again.
+
+	\param computeCost
+		   Function returns new cost of node with given index.
+	********************************************************************/
+	void Rebuild(const std::function<float(int)>& computeCost);
+
+private:
+	/*!*******************************************************************
+	\struct Entry
+	\brief
+		   Element of the heap.
+	********************************************************************/
+	struct Entry
+	{
+		float m_cost; //!< Cost of the node.
+		int m_node; //!< Index of the node.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Move entry at given index toward the root while its parent
+		   costs more.
+
+	\param index
+		   Index of entry in the heap.
+	********************************************************************/
+	void SiftUp(int index);
+	/*!*******************************************************************
+	\brief
+		   Move entry at given index toward leaves while a child costs
+		   less.
+
+	\param index
+		   Index of entry in the heap.
+	********************************************************************/
+	void SiftDown(int index);
+	/*!*******************************************************************
+	\brief
+		   Put entry at given index and record its position.
+
+	\param index
+		   Index in the heap.
+
+	\param entry
+		   Entry to put.
+	********************************************************************/
+	void Place(int index, const Entry& entry);
+
+private:
+	std::vector<Entry> m_entries; //!< Heap of nodes. Parent of entry i is entry (i - 1) / 2.
+	std::vector<int> m_positions; //!< Index of each node in the heap. Only valid for nodes in the container.
+};
+
+#endif // !INDEXEDHEAP_H
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*!*******************************************************************
+\file		  Isochrone.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include "Isochrone.h"
+
+void Isochrone::Initialize(const NavGraph& graph)
+{
+	m_graph = &graph;
+
+	m_context.Initialize(graph.GetTriangleCount());
+	m_entries.resize(graph.GetTriangleCount());
+	m_areas.clear();
+}
+
+void Isochrone::SetFilter(const QueryFilter& filter)
+{
+	m_filter = filter;
+}
+
+const std::vector<Isochrone::Area>& Isochrone::Compute(const Point& origin, float budget)
+{
+	m_areas.clear();
+
+	if (m_graph)
+		m_version = m_graph->GetVersion();
+
+	// Special case. Origin is not inside of polygon, or in excluded area or blocked triangle.
+	const int first = m_graph ? m_graph->FindTriangle(origin) : -1;
+	if (first < 0 || budget < 0.f || !m_filter.IsIncluded(m_graph->GetArea(first)) || m_graph->IsBlocked(first))
+		return m_areas;
+
+	m_context.Clear();
+	m_context.Open(first, -1, SearchContext::NoPortal, 0.f, 0.f);
+	m_entries[first] = origin;
+
+	while (!m_context.IsOpenListEmpty())
+	{
+		const int triangle = m_context.Close();
+		const SearchNode& thisNode = m_context.GetNode(triangle);
+		const Point& entry = m_entries[triangle];
+
+		m_areas.push_back(Area{ triangle, thisNode.m_given });
+
+		// Distance inside of this triangle costs as its area.
+		const float multiplier = m_filter.GetCost(m_graph->GetArea(triangle));
+
+		for (int i = 0; i < 3; ++i)
+		{
+			// Walls have area no filter includes, so this skips walls and excluded areas at once.
+			if (!m_filter.IsIncluded(m_graph->GetNeighborArea(triangle, i))) continue;
+
+			const int neighbor = m_graph->GetNeighbor(triangle, i);
+			if (m_graph->IsBlocked(neighbor)) continue;
+
+			const auto status = m_context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed) continue;
+
+			// Enter neighbor at the closest point of the shared edge.
+			const Point new_entry = ClosestPointOnSegment(entry, m_graph->GetVertex(triangle, i), m_graph->GetVertex(triangle, (i + 1) % 3));
+			const float new_given = thisNode.m_given + DistanceBetween(entry, new_entry) * multiplier;
+
+			// Over budget. Do not even push, so open list only has reachable ones.
+			if (new_given > budget) continue;
+
+			if (status == SearchNode::Status::Default || new_given < m_context.GetNode(neighbor).m_given)
+			{
+				m_context.Open(neighbor, triangle, m_graph->GetTwin(triangle, i), new_given, new_given);
+				m_entries[neighbor] = new_entry;
+			}
+		}
+
+		// Off-mesh links are rare, so flag in hot data is checked before side table.
+		if (!m_graph->HasLinks(triangle) || !m_filter.AreOffMeshLinksIncluded()) continue;
+
+		const int count = m_graph->GetLinkCount(triangle);
+		for (int i = 0; i < count; ++i)
+		{
+			const auto& offMeshLink = m_graph->GetOffMeshLink(m_graph->GetLink(triangle, i));
+
+			// Search goes from origin, so agent must leave this triangle by the link.
+			const bool isReversed = offMeshLink.m_startTriangle != triangle;
+			if (isReversed && !offMeshLink.m_isBidirectional) continue;
+
+			const int neighbor = isReversed ? offMeshLink.m_startTriangle : offMeshLink.m_endTriangle;
+			if (!m_filter.IsIncluded(m_graph->GetArea(neighbor)) || m_graph->IsBlocked(neighbor)) continue;
+
+			const auto status = m_context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed) continue;
+
+			// Walk to where link departs, pay for the link, and enter neighbor where it arrives.
+			const Point& departure = isReversed ? offMeshLink.m_end : offMeshLink.m_start;
+			const Point& arrival = isReversed ? offMeshLink.m_start : offMeshLink.m_end;
+			const float new_given = thisNode.m_given + DistanceBetween(entry, departure) * multiplier + offMeshLink.m_cost;
+
+			if (new_given > budget) continue;
+
+			if (status == SearchNode::Status::Default || new_given < m_context.GetNode(neighbor).m_given)
+			{
+				m_context.Open(neighbor, triangle, SearchContext::LinkPortal, new_given, new_given);
+				m_entries[neighbor] = arrival;
+			}
+		}
+	}
+
+	return m_areas;
+}
+
+const Point& Isochrone::GetEntry(int triangle) const
+{
+	return m_entries[triangle];
+}
+
+unsigned Isochrone::GetGraphVersion() const
+{
+	return m_version;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*!*******************************************************************
+\headerfile   Isochrone.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for Isochrone class which finds all
+			  triangles reachable within path cost budget.
+********************************************************************/
+#ifndef ISOCHRONE_H
+#define ISOCHRONE_H
+
+#include <vector>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "QueryFilter.h"
+#include "SearchContext.h"
+
+/*!*******************************************************************
+\class Isochrone
+\brief
+	   Dijkstra from a point which stops when path cost exceeds
+	   budget. Cost is distance times cost of area of filter, same
+	   as A* query. Nodes are reset lazily by search context, so work is
+	   proportional to the explored region, not the map.
+	   Path enters each triangle at the closest point of the portal
+	   from where it entered the previous triangle, or where off-mesh
+	   link arrives.
+********************************************************************/
+class Isochrone
+{
+public:
+	/*!*******************************************************************
+	\struct Area
+	\brief
+		   Triangle reachable within budget.
+	********************************************************************/
+	struct Area
+	{
+		int m_triangle; //!< Index of triangle.
+		float m_distance; //!< Path cost to enter the triangle.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Set graph to search on. Graph must not be moved while this
+		   query uses it, nor changed during Compute. Blocking
+		   triangles between calls only makes the last result stale.
+
+	\param graph
+		   Graph of navigation meshes of current map.
+	********************************************************************/
+	void Initialize(const NavGraph& graph);
+	/*!*******************************************************************
+	\brief
+		   Setter method for filter deciding cost and passability of
+		   area types. Excluded triangles are never reached.
+
+	\param filter
+		   New filter. Copied.
+	********************************************************************/
+	void SetFilter(const QueryFilter& filter);
+
+	/*!*******************************************************************
+	\brief
+		   Find all triangles whose entry cost from given point is at
+		   most given budget.
+
+	\param origin
+		   Point to start from.
+
+	\param budget
+		   The biggest path cost.
+
+	\return const std::vector<Area>&
+			Reachable triangles in increasing cost order, starting with
+			the triangle including origin. Empty if origin is not
+			inside of polygon or is in excluded area. Valid until next
+			call.
+	********************************************************************/
+	const std::vector<Area>& Compute(const Point& origin, float budget);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for the point where path entered given triangle.
+
+	\param triangle
+		   Index of triangle found by the last computation.
+
+	\return const Point&
+			Entry point on the portal, arrival point of off-mesh link,
+			or origin for the first triangle.
+	********************************************************************/
+	const Point& GetEntry(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for version of graph the last computation ran
+		   on. If it differs from NavGraph::GetVersion, the result may
+		   include blocked triangles or miss opened ones.
+
+	\return unsigned
+			Version of graph of the last computation.
+	********************************************************************/
+	unsigned GetGraphVersion() const;
+
+private:
+	const NavGraph* m_graph = nullptr; //!< Graph to search on. Owned by user of this query.
+	SearchContext m_context; //!< Nodes and open list for Dijkstra.
+	QueryFilter m_filter; //!< Cost and passability of area types.
+
+	std::vector<Point> m_entries; //!< Entry point of each triangle. Only valid for triangles touched by the last computation.
+	std::vector<Area> m_areas; //!< Result of the last computation.
+	unsigned m_version = 0; //!< Version of graph when the last computation ran.
+};
+
+#endif // !ISOCHRONE_H
\ No newline at end of file
@@ -0,0 +1,891 @@
+/*!*******************************************************************
+\file		  NavGraph.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "NavGraph.h"
+
+namespace
+{
+	const int MaxWalkSteps = 32; //!< The number of triangles a point can cross in one move.
+	const unsigned char AreaMask = 0x7F; //!< Bits of area type inside of Links::m_area.
+	const unsigned char LinkFlag = 0x80; //!< Bit of Links::m_area set if off-mesh links touch the triangle.
+	const float SnapInset = 0.01f; //!< How far snapped point is moved inside from the wall.
+
+	/*!*******************************************************************
+	\brief
+		   Check whether any edge of first polygon separates it from
+		   second polygon. Both must be convex.
+
+	\param first
+		   Vertices of polygon whose edges are tested.
+
+	\param firstCount
+		   The number of vertices of first polygon.
+
+	\param second
+		   Vertices of other polygon.
+
+	\param secondCount
+		   The number of vertices of second polygon.
+
+	\return bool
+			True if they do not overlap. Touching is not overlap.
+	********************************************************************/
+	bool HasSeparatingAxis(const Point* first, int firstCount, const Point* second, int secondCount)
+	{
+		// DotProduct normalizes, so projections are computed here.
+		const auto project = [](const Point& point, const Vector& axis) { return point.X * axis.X + point.Y * axis.Y; };
+
+		for (int i = 0; i < firstCount; ++i)
+		{
+			const Vector edge = first[(i + 1) % firstCount] - first[i];
+			const Vector axis(-edge.Y, edge.X);
+
+			float firstMin = std::numeric_limits<float>::max(), firstMax = -firstMin;
+			for (int j = 0; j < firstCount; ++j)
+			{
+				const float projected = project(first[j], axis);
+				firstMin = std::min(firstMin, projected);
+				firstMax = std::max(firstMax, projected);
+			}
+
+			float secondMin = std::numeric_limits<float>::max(), secondMax = -secondMin;
+			for (int j = 0; j < secondCount; ++j)
+			{
+				const float projected = project(second[j], axis);
+				secondMin = std::min(secondMin, projected);
+				secondMax = std::max(secondMax, projected);
+			}
+
+			if (firstMax <= secondMin || secondMax <= firstMin)
+				return true;
+		}
+
+		return false;
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Compute bytes reserved by given vector.
+	********************************************************************/
+	template <class T>
+	size_t GetReservedBytes(const std::vector<T>& values)
+	{
+		return values.capacity() * sizeof(T);
+	}
+}
+
+void NavGraph::Build(const std::vector<NavMeshManager::NavMesh>& meshes)
+{
+	const int size = static_cast<int>(meshes.size());
+	const auto base = meshes.data();
+
+	m_links.resize(size);
+	m_offMeshLinks.clear();
+	m_linkOffsets.assign(size + 1, 0);
+	m_linkIndices.clear();
+	m_minLinkCostRatio = 1.f;
+	m_blocked.assign((size + 31) / 32, 0u);
+	++m_version;
+	m_vertices.resize(size * 3);
+	m_clearances.resize(size * 3);
+	m_bounds.resize(size);
+
+	// Sort triangles along Z-order curve of centers, so neighbors are likely close in memory too.
+	SortSpatially(meshes);
+
+	std::vector<int> graphIndices(size);
+	for (int i = 0; i < size; ++i)
+		graphIndices[m_meshIndices[i]] = i;
+
+	for (int i = 0; i < size; ++i)
+	{
+		const auto& mesh = meshes[m_meshIndices[i]];
+		auto& links = m_links[i];
+		auto& bounds = m_bounds[i];
+
+		links.m_area = 0;
+
+		bounds.m_min = bounds.m_max = mesh.m_edges[0].m_start;
+
+		for (int j = 0; j < 3; ++j)
+		{
+			const auto& edge = mesh.m_edges[j];
+			const NavMeshManager::NavMesh* neighbor = mesh.m_neighbors[j];
+
+			m_vertices[i * 3 + j] = edge.m_start;
+			m_clearances[i * 3 + j] = mesh.m_clearances[j];
+			links.m_midpoints[j] = (edge.m_start + edge.m_end) / 2.f;
+			links.m_neighbors[j] = -1;
+			links.m_edges[j] = static_cast<unsigned char>(WallArea << 2);
+
+			bounds.m_min = Point(std::min(bounds.m_min.X, edge.m_start.X), std::min(bounds.m_min.Y, edge.m_start.Y));
+			bounds.m_max = Point(std::max(bounds.m_max.X, edge.m_start.X), std::max(bounds.m_max.Y, edge.m_start.Y));
+
+			if (neighbor == nullptr) continue;
+
+			links.m_neighbors[j] = graphIndices[neighbor - base];
+
+			// Find same edge in the neighbor.
+			int twin = 0;
+			while (neighbor->m_neighbors[twin] != &mesh)
+				++twin;
+
+			links.m_edges[j] = static_cast<unsigned char>(twin);
+		}
+	}
+
+	BuildWallGrid();
+	BuildComponents();
+}
+
+int NavGraph::GetTriangleCount() const
+{
+	return static_cast<int>(m_links.size());
+}
+
+int NavGraph::FindTriangle(const Point& position) const
+{
+	const int size = GetTriangleCount();
+	for (int i = 0; i < size; ++i)
+	{
+		// Check cheap test first. Box bounding triangle.
+		const auto& bounds = m_bounds[i];
+		if (position.X < bounds.m_min.X || position.X > bounds.m_max.X) continue;
+		if (position.Y < bounds.m_min.Y || position.Y > bounds.m_max.Y) continue;
+
+		// Check expensive test.
+		if (IsPointInside(i, position))
+			return i;
+	}
+
+	return -1;
+}
+
+int NavGraph::FindNearestTriangle(Point& position, float searchRadius) const
+{
+	const int triangle = FindTriangle(position);
+	if (triangle >= 0 || searchRadius <= 0.f || m_walls.empty())
+		return triangle;
+
+	const int minX = GetWallCell(position.X - searchRadius, m_wallOrigin.X, m_wallColumns);
+	const int maxX = GetWallCell(position.X + searchRadius, m_wallOrigin.X, m_wallColumns);
+	const int minY = GetWallCell(position.Y - searchRadius, m_wallOrigin.Y, m_wallRows);
+	const int maxY = GetWallCell(position.Y + searchRadius, m_wallOrigin.Y, m_wallRows);
+
+	// Point outside of graph is closest to some wall. Same wall can be in several cells, but it is cheap to check again.
+	int nearest = -1;
+	float nearestDistanceSq = searchRadius * searchRadius;
+	Point nearestPoint;
+
+	for (int y = minY; y <= maxY; ++y)
+	{
+		for (int x = minX; x <= maxX; ++x)
+		{
+			const int cell = y * m_wallColumns + x;
+			for (int i = m_wallOffsets[cell]; i < m_wallOffsets[cell + 1]; ++i)
+			{
+				const int wall = m_walls[i];
+				const Point closest = ClosestPointOnSegment(position, m_vertices[wall], GetVertex(wall / 3, (wall % 3 + 1) % 3));
+
+				const float dx = closest.X - position.X;
+				const float dy = closest.Y - position.Y;
+				const float distanceSq = dx * dx + dy * dy;
+
+				if (distanceSq <= nearestDistanceSq)
+				{
+					nearestDistanceSq = distanceSq;
+					nearestPoint = closest;
+					nearest = wall;
+				}
+			}
+		}
+	}
+
+	if (nearest < 0)
+		return -1;
+
+	// Pull slightly inside, so point is not on the wall. Fixed length, so large triangle does not move it far.
+	const int nearestTriangle = nearest / 3;
+	const Point center = (GetVertex(nearestTriangle, 0) + GetVertex(nearestTriangle, 1) + GetVertex(nearestTriangle, 2)) / 3.f;
+	const Vector inward = center - nearestPoint;
+	const float length = Magnitude(inward);
+
+	position = nearestPoint;
+	if (length > 0.f)
+		position += inward * (std::min(SnapInset, length * 0.5f) / length);
+
+	return nearestTriangle;
+}
+
+int NavGraph::GetNeighbor(int triangle, int edge) const
+{
+	return m_links[triangle].m_neighbors[edge];
+}
+
+int NavGraph::GetTwin(int triangle, int edge) const
+{
+	return m_links[triangle].m_edges[edge] & 3;
+}
+
+int NavGraph::GetArea(int triangle) const
+{
+	return m_links[triangle].m_area & AreaMask;
+}
+
+void NavGraph::SetArea(int triangle, int area)
+{
+	auto& links = m_links[triangle];
+	links.m_area = static_cast<unsigned char>((links.m_area & LinkFlag) | area);
+	++m_version;
+
+	// Neighbors keep area of this triangle on the shared edge.
+	for (int i = 0; i < 3; ++i)
+	{
+		const int neighbor = links.m_neighbors[i];
+		if (neighbor < 0) continue;
+
+		unsigned char& edge = m_links[neighbor].m_edges[GetTwin(triangle, i)];
+		edge = static_cast<unsigned char>((edge & 3) | (area << 2));
+	}
+}
+
+int NavGraph::GetNeighborArea(int triangle, int edge) const
+{
+	return m_links[triangle].m_edges[edge] >> 2;
+}
+
+int NavGraph::SetOffMeshLinks(const std::vector<OffMeshLink>& links)
+{
+	const int size = GetTriangleCount();
+	int usable = 0;
+
+	m_offMeshLinks = links;
+	m_minLinkCostRatio = 1.f;
+	m_linkOffsets.assign(size + 1, 0);
+
+	for (auto& link : m_links)
+		link.m_area &= AreaMask;
+
+	// Find both ends, and count links of each triangle.
+	for (auto& link : m_offMeshLinks)
+	{
+		link.m_startTriangle = FindTriangle(link.m_start);
+		link.m_endTriangle = FindTriangle(link.m_end);
+
+		if (link.m_startTriangle < 0 || link.m_endTriangle < 0)
+		{
+			link.m_startTriangle = link.m_endTriangle = -1;
+			continue;
+		}
+
+		const float distance = DistanceBetween(link.m_start, link.m_end);
+		if (link.m_cost < 0.f)
+			link.m_cost = distance;
+		else if (distance > 0.f)
+			m_minLinkCostRatio = std::min(m_minLinkCostRatio, link.m_cost / distance);
+
+		++m_linkOffsets[link.m_startTriangle + 1];
+		if (link.m_endTriangle != link.m_startTriangle)
+			++m_linkOffsets[link.m_endTriangle + 1];
+
+		++usable;
+	}
+
+	for (int i = 0; i < size; ++i)
+		m_linkOffsets[i + 1] += m_linkOffsets[i];
+
+	// Put each link into range of both triangles.
+	std::vector<int> next(m_linkOffsets.begin(), m_linkOffsets.end() - 1);
+	m_linkIndices.resize(m_linkOffsets.back());
+
+	const int linkCount = GetOffMeshLinkCount();
+	for (int i = 0; i < linkCount; ++i)
+	{
+		const auto& link = m_offMeshLinks[i];
+		if (link.m_startTriangle < 0) continue;
+
+		m_linkIndices[next[link.m_startTriangle]++] = i;
+		m_links[link.m_startTriangle].m_area |= LinkFlag;
+
+		if (link.m_endTriangle != link.m_startTriangle)
+		{
+			m_linkIndices[next[link.m_endTriangle]++] = i;
+			m_links[link.m_endTriangle].m_area |= LinkFlag;
+		}
+	}
+
+	BuildComponents();
+	++m_version;
+	return usable;
+}
+
+int NavGraph::GetOffMeshLinkCount() const
+{
+	return static_cast<int>(m_offMeshLinks.size());
+}
+
+const NavGraph::OffMeshLink& NavGraph::GetOffMeshLink(int link) const
+{
+	return m_offMeshLinks[link];
+}
+
+bool NavGraph::HasLinks(int triangle) const
+{
+	return (m_links[triangle].m_area & LinkFlag) != 0;
+}
+
+int NavGraph::GetLinkCount(int triangle) const
+{
+	return m_linkOffsets[triangle + 1] - m_linkOffsets[triangle];
+}
+
+int NavGraph::GetLink(int triangle, int index) const
+{
+	return m_linkIndices[m_linkOffsets[triangle] + index];
+}
+
+float NavGraph::GetMinLinkCostRatio() const
+{
+	return m_minLinkCostRatio;
+}
+
+void NavGraph::SetBlocked(int triangle, bool isBlocked)
+{
+	if (ChangeBlocked(triangle, isBlocked))
+		++m_version;
+}
+
+bool NavGraph::IsBlocked(int triangle) const
+{
+	return (m_blocked[triangle >> 5] >> (triangle & 31)) & 1u;
+}
+
+int NavGraph::SetBlockedInCircle(const Point& center, float radius, bool isBlocked)
+{
+	int changed = 0;
+
+	const int size = GetTriangleCount();
+	for (int i = 0; i < size; ++i)
+	{
+		// Check cheap test first. Box bounding triangle.
+		const auto& bounds = m_bounds[i];
+		if (center.X + radius <= bounds.m_min.X || center.X - radius >= bounds.m_max.X) continue;
+		if (center.Y + radius <= bounds.m_min.Y || center.Y - radius >= bounds.m_max.Y) continue;
+
+		// Circle overlaps if center is inside, or any edge is closer than radius.
+		bool overlaps = IsPointInside(i, center);
+		for (int j = 0; j < 3 && !overlaps; ++j)
+			overlaps = DistanceToSegment(center, GetVertex(i, j), GetVertex(i, (j + 1) % 3)) < radius;
+
+		if (overlaps && ChangeBlocked(i, isBlocked))
+			++changed;
+	}
+
+	if (changed > 0)
+		++m_version;
+
+	return changed;
+}
+
+int NavGraph::SetBlockedInPolygon(const std::vector<Point>& polygon, bool isBlocked)
+{
+	const int count = static_cast<int>(polygon.size());
+	if (count < 3) return 0;
+
+	// Box bounding polygon.
+	Bounds shape{ polygon[0], polygon[0] };
+	for (const Point& point : polygon)
+	{
+		shape.m_min = Point(std::min(shape.m_min.X, point.X), std::min(shape.m_min.Y, point.Y));
+		shape.m_max = Point(std::max(shape.m_max.X, point.X), std::max(shape.m_max.Y, point.Y));
+	}
+
+	int changed = 0;
+
+	const int size = GetTriangleCount();
+	for (int i = 0; i < size; ++i)
+	{
+		// Check cheap test first. Box bounding triangle.
+		const auto& bounds = m_bounds[i];
+		if (shape.m_max.X <= bounds.m_min.X || shape.m_min.X >= bounds.m_max.X) continue;
+		if (shape.m_max.Y <= bounds.m_min.Y || shape.m_min.Y >= bounds.m_max.Y) continue;
+
+		// Convex shapes overlap unless an edge of either one separates them.
+		const Point* vertices = &m_vertices[i * 3];
+		if (HasSeparatingAxis(vertices, 3, polygon.data(), count) || HasSeparatingAxis(polygon.data(), count, vertices, 3)) continue;
+
+		if (ChangeBlocked(i, isBlocked))
+			++changed;
+	}
+
+	if (changed > 0)
+		++m_version;
+
+	return changed;
+}
+
+unsigned NavGraph::GetVersion() const
+{
+	return m_version;
+}
+
+size_t NavGraph::GetMemoryUsage() const
+{
+	return sizeof(NavGraph)
+		+ GetReservedBytes(m_links) + GetReservedBytes(m_vertices) + GetReservedBytes(m_clearances) + GetReservedBytes(m_bounds)
+		+ GetReservedBytes(m_meshIndices) + GetReservedBytes(m_components)
+		+ GetReservedBytes(m_offMeshLinks) + GetReservedBytes(m_linkOffsets) + GetReservedBytes(m_linkIndices)
+		+ GetReservedBytes(m_blocked) + GetReservedBytes(m_wallOffsets) + GetReservedBytes(m_walls);
+}
+
+int NavGraph::GetMeshIndex(int triangle) const
+{
+	return m_meshIndices[triangle];
+}
+
+int NavGraph::GetComponent(int triangle) const
+{
+	return m_components[triangle];
+}
+
+int NavGraph::GetComponentCount() const
+{
+	return m_componentCount;
+}
+
+bool NavGraph::AreConnected(int triangle1, int triangle2) const
+{
+	return m_components[triangle1] == m_components[triangle2];
+}
+
+const Point& NavGraph::GetMidpoint(int triangle, int edge) const
+{
+	return m_links[triangle].m_midpoints[edge];
+}
+
+const Point& NavGraph::GetVertex(int triangle, int index) const
+{
+	return m_vertices[triangle * 3 + index];
+}
+
+float NavGraph::GetClearance(int triangle, int edge) const
+{
+	return m_clearances[triangle * 3 + edge];
+}
+
+int NavGraph::FindEdge(int triangle, int neighbor) const
+{
+	const auto& neighbors = m_links[triangle].m_neighbors;
+	for (int i = 0; i < 3; ++i)
+	{
+		if (neighbors[i] == neighbor)
+			return i;
+	}
+
+	return -1;
+}
+
+void NavGraph::GetPortal(int triangle, int edge, float radius, Point& left, Point& right) const
+{
+	const Point& start = GetVertex(triangle, edge);
+	const Point& end = GetVertex(triangle, (edge + 1) % 3);
+	const Point& apex = GetVertex(triangle, (edge + 2) % 3); // Vertex of this triangle, which is not on the portal.
+
+	// Apex is on the near side of portal, so it tells which vertex is on the left.
+	left = start;
+	right = end;
+	if (TriArea(apex, start, end) < 0.f)
+		std::swap(left, right);
+
+	// Narrow the portal by radius of agent, so path does not touch corners.
+	if (radius > 0.f)
+	{
+		Vector offset = right - left;
+		const float length = Magnitude(offset);
+
+		if (length > radius * 2.f)
+		{
+			offset = offset * (radius / length);
+			left += offset;
+			right = right - offset;
+		}
+		else
+			left = right = (left + right) / 2.f;
+	}
+}
+
+int NavGraph::MoveAlongSurface(int triangle, const Point& from, Point& to, std::vector<int>* visited) const
+{
+	const int first = triangle;
+	const size_t visitedSize = visited ? visited->size() : 0;
+
+	if (visited)
+		visited->push_back(triangle);
+
+	for (int step = 0; step < MaxWalkSteps; ++step)
+	{
+		int exit = -1;
+		int outside = -1;
+
+		// Find edge which destination is outside of, and segment goes through.
+		for (int i = 0; i < 3; ++i)
+		{
+			const Point& start = GetVertex(triangle, i);
+			const Point& end = GetVertex(triangle, (i + 1) % 3);
+			const Point& apex = GetVertex(triangle, (i + 2) % 3);
+
+			const float inside = TriArea(start, end, apex);
+			if (TriArea(start, end, to) * inside >= 0.f) continue;
+
+			if (outside < 0)
+				outside = i;
+
+			// Vertices of edge are on different sides of the segment.
+			if (TriArea(from, to, start) * TriArea(from, to, end) <= 0.f)
+			{
+				exit = i;
+				break;
+			}
+		}
+
+		// Destination is inside of this triangle.
+		if (outside < 0)
+			return triangle;
+
+		// Segment touches a vertex, so crossing test failed by error. Go through any edge destination is outside of.
+		if (exit < 0)
+			exit = outside;
+
+		// Blocked triangle stops walk same as wall.
+		const int neighbor = GetNeighbor(triangle, exit);
+		if (neighbor >= 0 && !IsBlocked(neighbor))
+		{
+			triangle = neighbor;
+			if (visited)
+				visited->push_back(triangle);
+
+			continue;
+		}
+
+		// Wall. Slide along it, and pull slightly inside.
+		const Point& start = GetVertex(triangle, exit);
+		const Point& end = GetVertex(triangle, (exit + 1) % 3);
+		const Point center = (start + end + GetVertex(triangle, (exit + 2) % 3)) / 3.f;
+
+		to = ClosestPointOnSegment(to, start, end);
+		to += (center - to) * 0.001f;
+	}
+
+	// Walked too far. Stay.
+	if (visited)
+		visited->resize(visitedSize + 1);
+
+	to = from;
+	return first;
+}
+
+bool NavGraph::Raycast(int triangle, const Point& start, const Point& end, RaycastHit& hit, std::vector<int>* visited) const
+{
+	hit = RaycastHit();
+
+	// Each triangle is crossed at most once along a straight segment.
+	int entry = -1;
+	const int size = GetTriangleCount();
+
+	for (int step = 0; step < size; ++step)
+	{
+		if (visited)
+			visited->push_back(triangle);
+
+		int exit = -1;
+		int outside = -1;
+
+		// Find edge which end point is outside of, and segment goes through.
+		for (int i = 0; i < 3; ++i)
+		{
+			if (i == entry) continue;
+
+			const Point& edgeStart = GetVertex(triangle, i);
+			const Point& edgeEnd = GetVertex(triangle, (i + 1) % 3);
+			const Point& apex = GetVertex(triangle, (i + 2) % 3);
+
+			if (TriArea(edgeStart, edgeEnd, end) * TriArea(edgeStart, edgeEnd, apex) >= 0.f) continue;
+
+			if (outside < 0)
+				outside = i;
+
+			// Vertices of edge are on different sides of the segment.
+			if (TriArea(start, end, edgeStart) * TriArea(start, end, edgeEnd) <= 0.f)
+			{
+				exit = i;
+				break;
+			}
+		}
+
+		// End point is inside of this triangle.
+		if (outside < 0)
+		{
+			hit.m_triangle = triangle;
+			return false;
+		}
+
+		// Segment touches a vertex, so crossing test failed by error. Go through any edge end point is outside of.
+		if (exit < 0)
+			exit = outside;
+
+		// Blocked triangle stops ray same as wall.
+		const int neighbor = GetNeighbor(triangle, exit);
+		if (neighbor < 0 || IsBlocked(neighbor))
+		{
+			// Ratio where segment crosses the wall, from distance of both points to it.
+			const Point& edgeStart = GetVertex(triangle, exit);
+			const Point& edgeEnd = GetVertex(triangle, (exit + 1) % 3);
+			const float startSide = TriArea(edgeStart, edgeEnd, start);
+			const float endSide = TriArea(edgeStart, edgeEnd, end);
+
+			hit.m_t = startSide != endSide ? std::min(std::max(startSide / (startSide - endSide), 0.f), 1.f) : 0.f;
+			hit.m_triangle = triangle;
+			hit.m_edge = exit;
+			return true;
+		}
+
+		entry = GetTwin(triangle, exit);
+		triangle = neighbor;
+	}
+
+	// Cannot happen on valid graph. Treat as blocked at start.
+	hit.m_t = 0.f;
+	hit.m_triangle = triangle;
+	return true;
+}
+
+void NavGraph::BuildWallGrid()
+{
+	m_walls.clear();
+	m_wallOffsets.clear();
+	m_wallColumns = m_wallRows = 0;
+
+	// Box bounding every wall.
+	int wallCount = 0;
+	Point min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+	Point max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+
+	const int size = GetTriangleCount();
+	for (int i = 0; i < size; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			if (GetNeighbor(i, j) >= 0) continue;
+
+			++wallCount;
+			const Point& vertex = GetVertex(i, j);
+			min = Point(std::min(min.X, vertex.X), std::min(min.Y, vertex.Y));
+			max = Point(std::max(max.X, vertex.X), std::max(max.Y, vertex.Y));
+		}
+	}
+
+	if (wallCount == 0) return;
+
+	// About one wall for each cell.
+	const float width = std::max(max.X - min.X, max.Y - min.Y);
+	const int cellsPerSide = std::min(std::max(static_cast<int>(std::sqrt(static_cast<float>(wallCount))), 1), 1024);
+
+	m_wallOrigin = min;
+	m_wallCellSize = std::max(width / cellsPerSide, 1e-3f);
+	m_wallColumns = static_cast<int>((max.X - min.X) / m_wallCellSize) + 1;
+	m_wallRows = static_cast<int>((max.Y - min.Y) / m_wallCellSize) + 1;
+
+	// Count walls of each cell first, and then fill them.
+	m_wallOffsets.assign(m_wallColumns * m_wallRows + 1, 0);
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		std::vector<int> next;
+		if (pass == 1)
+		{
+			for (size_t i = 1; i < m_wallOffsets.size(); ++i)
+				m_wallOffsets[i] += m_wallOffsets[i - 1];
+
+			next.assign(m_wallOffsets.begin(), m_wallOffsets.end() - 1);
+			m_walls.resize(m_wallOffsets.back());
+		}
+
+		for (int i = 0; i < size; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				if (GetNeighbor(i, j) >= 0) continue;
+
+				const Point& start = GetVertex(i, j);
+				const Point& end = GetVertex(i, (j + 1) % 3);
+
+				const int minX = GetWallCell(std::min(start.X, end.X), m_wallOrigin.X, m_wallColumns);
+				const int maxX = GetWallCell(std::max(start.X, end.X), m_wallOrigin.X, m_wallColumns);
+				const int minY = GetWallCell(std::min(start.Y, end.Y), m_wallOrigin.Y, m_wallRows);
+				const int maxY = GetWallCell(std::max(start.Y, end.Y), m_wallOrigin.Y, m_wallRows);
+
+				for (int y = minY; y <= maxY; ++y)
+				{
+					for (int x = minX; x <= maxX; ++x)
+					{
+						const int cell = y * m_wallColumns + x;
+						if (pass == 0)
+							++m_wallOffsets[cell + 1];
+						else
+							m_walls[next[cell]++] = i * 3 + j;
+					}
+				}
+			}
+		}
+	}
+}
+
+void NavGraph::BuildComponents()
+{
+	const int size = GetTriangleCount();
+
+	// Each triangle starts as its own set.
+	std::vector<int> parents(size);
+	for (int i = 0; i < size; ++i)
+		parents[i] = i;
+
+	// Halve the path while finding root, so trees stay flat.
+	const auto find = [&parents](int triangle) {
+		while (parents[triangle] != triangle)
+		{
+			parents[triangle] = parents[parents[triangle]];
+			triangle = parents[triangle];
+		}
+
+		return triangle;
+	};
+
+	for (int i = 0; i < size; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			const int neighbor = GetNeighbor(i, j);
+			if (neighbor < i) continue; // Walls, and links already merged from the other side.
+
+			const int root = find(i);
+			const int neighborRoot = find(neighbor);
+
+			// Smaller index becomes root, so labels below follow order of triangles.
+			if (root != neighborRoot)
+				parents[std::max(root, neighborRoot)] = std::min(root, neighborRoot);
+		}
+	}
+
+	// Links join components too. One-way links are treated as both ways, so different components still means no path.
+	for (const auto& link : m_offMeshLinks)
+	{
+		if (link.m_startTriangle < 0) continue;
+
+		const int root = find(link.m_startTriangle);
+		const int otherRoot = find(link.m_endTriangle);
+
+		if (root != otherRoot)
+			parents[std::max(root, otherRoot)] = std::min(root, otherRoot);
+	}
+
+	// Number roots from 0.
+	m_components.resize(size);
+	m_componentCount = 0;
+
+	for (int i = 0; i < size; ++i)
+	{
+		const int root = find(i);
+		m_components[i] = root == i ? m_componentCount++ : m_components[root];
+	}
+}
+
+int NavGraph::GetWallCell(float value, float origin, int count) const
+{
+	const int cell = static_cast<int>(std::floor((value - origin) / m_wallCellSize));
+	return std::min(std::max(cell, 0), count - 1);
+}
+
+bool NavGraph::ChangeBlocked(int triangle, bool isBlocked)
+{
+	unsigned& word = m_blocked[triangle >> 5];
+	const unsigned bit = 1u << (triangle & 31);
+
+	const unsigned old = word;
+	word = isBlocked ? word | bit : word & ~bit;
+
+	return word != old;
+}
+
+bool NavGraph::IsPointInside(int triangle, const Point& position) const
+{
+	const Point* vertices = &m_vertices[triangle * 3];
+
+	// Position of point upon first edge.
+	const bool direction = ScalarTripleProduct(vertices[1] - vertices[0], position - vertices[0]) <= 0.f;
+
+	// Direction must be same for all edges.
+	for (int i = 1; i < 3; ++i)
+	{
+		const Point& start = vertices[i];
+		const Point& end = vertices[(i + 1) % 3];
+
+		if ((ScalarTripleProduct(end - start, position - start) <= 0.f) != direction)
+			return false;
+	}
+
+	return true;
+}
+
+void NavGraph::SortSpatially(const std::vector<NavMeshManager::NavMesh>& meshes)
+{
+	const int size = static_cast<int>(meshes.size());
+
+	m_meshIndices.resize(size);
+	if (size == 0) return;
+
+	// Center of each triangle, and box bounding all of them.
+	std::vector<Point> centers(size);
+	Point min = (meshes[0].m_edges[0].m_start + meshes[0].m_edges[1].m_start + meshes[0].m_edges[2].m_start) / 3.f;
+	Point max = min;
+
+	for (int i = 0; i < size; ++i)
+	{
+		const auto& edges = meshes[i].m_edges;
+		centers[i] = (edges[0].m_start + edges[1].m_start + edges[2].m_start) / 3.f;
+
+		min = Point(std::min(min.X, centers[i].X), std::min(min.Y, centers[i].Y));
+		max = Point(std::max(max.X, centers[i].X), std::max(max.Y, centers[i].Y));
+	}
+
+	// Spread lower 16 bits, so one bit of other coordinate goes between each bit.
+	const auto spread = [](unsigned value) {
+		value = (value | (value << 8)) & 0x00FF00FFu;
+		value = (value | (value << 4)) & 0x0F0F0F0Fu;
+		value = (value | (value << 2)) & 0x33333333u;
+		value = (value | (value << 1)) & 0x55555555u;
+		return value;
+	};
+
+	const float scaleX = max.X > min.X ? 65535.f / (max.X - min.X) : 0.f;
+	const float scaleY = max.Y > min.Y ? 65535.f / (max.Y - min.Y) : 0.f;
+
+	std::vector<std::pair<unsigned, int>> codes(size);
+	for (int i = 0; i < size; ++i)
+	{
+		const unsigned x = static_cast<unsigned>((centers[i].X - min.X) * scaleX);
+		const unsigned y = static_cast<unsigned>((centers[i].Y - min.Y) * scaleY);
+		codes[i] = std::make_pair(spread(x) | (spread(y) << 1), i);
+	}
+
+	std::sort(codes.begin(), codes.end());
+
+	for (int i = 0; i < size; ++i)
+		m_meshIndices[i] = codes[i].second;
+}
\ No newline at end of file
@@ -0,0 +1,640 @@
+/*!*******************************************************************
+\headerfile   NavGraph.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for NavGraph class which stores static
+			  adjacency of navigation meshes compactly for searching.
+********************************************************************/
+#ifndef NAVGRAPH_H
+#define NAVGRAPH_H
+
+#include <vector>
+
+#include "Point.h"
+
+#include "NavMeshManager.h"
+
+/*!*******************************************************************
+\class NavGraph
+\brief
+	   Read-only graph of triangles built from navigation meshes.
+	   Data needed for relaxing neighbors is packed together, and
+	   data needed rarely is stored in separate arrays.
+	   Edge i of triangle is from vertex i to vertex i + 1.
+********************************************************************/
+class NavGraph
+{
+public:
+	static const int MaxAreas = 32; //!< The number of area types, including WallArea.
+	static const int WallArea = MaxAreas - 1; //!< Area type across walls. Never walkable.
+
+	/*!*******************************************************************
+	\struct OffMeshLink
+	\brief
+		   Connection between two points which is not walked on
+		   triangles, like jump, ladder or teleporter.
+	********************************************************************/
+	struct OffMeshLink
+	{
+		Point m_start; //!< Point where link begins.
+		Point m_end; //!< Point where link ends.
+		float m_cost = -1.f; //!< Cost to go through link. If it is negative, distance between both points.
+		bool m_isBidirectional = true; //!< False if link can be used only from start to end.
+		int m_startTriangle = -1; //!< Triangle including start point. Set by graph.
+		int m_endTriangle = -1; //!< Triangle including end point. Set by graph.
+	};
+
+	/*!*******************************************************************
+	\struct RaycastHit
+	\brief
+		   Where segment stopped by Raycast.
+	********************************************************************/
+	struct RaycastHit
+	{
+		float m_t = 1.f; //!< Ratio of segment walked. 1 if nothing was hit.
+		int m_triangle = -1; //!< Triangle segment stopped in. Includes end point if nothing was hit.
+		int m_edge = -1; //!< Wall edge of m_triangle which was hit. -1 if nothing was hit.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Build graph from given navigation meshes.
+		   All meshes must be triangles with neighbors set.
+
+	\param meshes
+		   Navigation meshes generated by NavMeshManager.
+	********************************************************************/
+	void Build(const std::vector<NavMeshManager::NavMesh>& meshes);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of triangles.
+
+	\return int
+			The number of triangles.
+	********************************************************************/
+	int GetTriangleCount() const;
+	/*!*******************************************************************
+	\brief
+		   Find triangle that include given position.
+		   Check bounding box first, and then test for actual triangle.
+
+	\param position
+		   Point to check.
+
+	\return int
+			Index of triangle. -1 if point is not inside of any.
+	********************************************************************/
+	int FindTriangle(const Point& position) const;
+	/*!*******************************************************************
+	\brief
+		   Find triangle that include given position. If it is not
+		   inside of any, move it onto the closest wall within given
+		   distance, slightly inside of the triangle.
+		   Walls are found by grid, so only walls near the position
+		   are checked.
+
+	\param position
+		   Point to check. Changed to the closest point on graph.
+
+	\param searchRadius
+		   How far position can be moved.
+
+	\return int
+			Index of triangle including moved position. -1 if there is
+			no wall within the distance.
+	********************************************************************/
+	int FindNearestTriangle(Point& position, float searchRadius) const;
+	/*!*******************************************************************
+	\brief
+		   Check whether given position is inside of given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\param position
+		   Point to check.
+
+	\return bool
+			If point is inside triangle, returns true.
+			Otherwise, return false.
+	********************************************************************/
+	bool IsPointInside(int triangle, const Point& position) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for index of navigation mesh which given
+		   triangle is made from. Triangles are sorted spatially, so
+		   the order is different with navigation meshes.
+
+	\param triangle
+		   Index of triangle.
+
+	\return int
+			Index of navigation mesh.
+	********************************************************************/
+	int GetMeshIndex(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for connected component of given triangle.
+		   Triangles of different components have no path between
+		   them.
+
+	\param triangle
+		   Index of triangle.
+
+	\return int
+			Index of component, from 0 to GetComponentCount() - 1.
+	********************************************************************/
+	int GetComponent(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of connected components.
+
+	\return int
+			The number of components.
+	********************************************************************/
+	int GetComponentCount() const;
+	/*!*******************************************************************
+	\brief
+		   Check whether there can be path between given triangles.
+
+	\param triangle1
+		   Index of triangle.
+
+	\param triangle2
+		   Index of other triangle.
+
+	\return bool
+			False if they are in different components.
+	********************************************************************/
+	bool AreConnected(int triangle1, int triangle2) const;
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for neighbor across given edge.
+
+	\param triangle
+		   Index of triangle.
+
+	\param edge
+		   Index of edge.
+
+	\return int
+			Index of neighbor. -1 if edge is a wall.
+	********************************************************************/
+	int GetNeighbor(int triangle, int edge) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for index of given edge inside of the neighbor
+		   across it.
+
+	\param triangle
+		   Index of triangle.
+
+	\param edge
+		   Index of edge.
+
+	\return int
+			Index of same edge in the neighbor.
+	********************************************************************/
+	int GetTwin(int triangle, int edge) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for area type of given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\return int
+			Area type. 0 by default.
+	********************************************************************/
+	int GetArea(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Setter method for area type of given triangle. Must not be
+		   called while queries use this graph.
+
+	\param triangle
+		   Index of triangle.
+
+	\param area
+		   Area type. From 0 to WallArea - 1.
+	********************************************************************/
+	void SetArea(int triangle, int area);
+	/*!*******************************************************************
+	\brief
+		   Getter method for area type of the neighbor across given
+		   edge. Stored with the edge, so it is read without touching
+		   the neighbor.
+
+	\param triangle
+		   Index of triangle.
+
+	\param edge
+		   Index of edge.
+
+	\return int
+			Area type of the neighbor. WallArea if edge is a wall.
+	********************************************************************/
+	int GetNeighborArea(int triangle, int edge) const;
+
+	/*!*******************************************************************
+	\brief
+		   Replace off-mesh links. Each triangle keeps index of links
+		   touching it in a side table, so triangles without links do
+		   not pay for them. Components are labeled again with links,
+		   so searches in progress must be started again.
+
+	\param links
+		   New links. Triangles of both ends are found here, and links
+		   whose end is not inside of polygon are never used.
+
+	\return int
+			The number of links which can be used.
+	********************************************************************/
+	int SetOffMeshLinks(const std::vector<OffMeshLink>& links);
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of off-mesh links.
+
+	\return int
+			The number of links, including ones cannot be used.
+	********************************************************************/
+	int GetOffMeshLinkCount() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for off-mesh link.
+
+	\param link
+		   Index of link.
+
+	\return const OffMeshLink&
+			The link, with triangles of both ends.
+	********************************************************************/
+	const OffMeshLink& GetOffMeshLink(int link) const;
+	/*!*******************************************************************
+	\brief
+		   Check whether any off-mesh link touches given triangle.
+		   Stored with hot data, so it is cheap during search.
+
+	\param triangle
+		   Index of triangle.
+
+	\return bool
+			True if triangle has links.
+	********************************************************************/
+	bool HasLinks(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of off-mesh links starting or
+		   ending inside of given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\return int
+			The number of links.
+	********************************************************************/
+	int GetLinkCount(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for off-mesh link of given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\param index
+		   From 0 to GetLinkCount(triangle) - 1.
+
+	\return int
+			Index of link.
+	********************************************************************/
+	int GetLink(int triangle, int index) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the smallest ratio of cost to distance
+		   among off-mesh links. Heuristic is scaled by it, so links
+		   cheaper than walking do not make it overestimate.
+
+	\return float
+			The smallest ratio, or 1 if every link costs more than
+			walking.
+	********************************************************************/
+	float GetMinLinkCostRatio() const;
+
+	/*!*******************************************************************
+	\brief
+		   Block or unblock given triangle, like closed door. Blocked
+		   triangles are never entered by search or walk, but the graph
+		   is not built again. Must not be called while other threads
+		   read the graph.
+
+	\param triangle
+		   Index of triangle.
+
+	\param isBlocked
+		   True to block.
+	********************************************************************/
+	void SetBlocked(int triangle, bool isBlocked);
+	/*!*******************************************************************
+	\brief
+		   Check whether given triangle is blocked. One bit for each
+		   triangle, so it is cheap during search.
+
+	\param triangle
+		   Index of triangle.
+
+	\return bool
+			True if triangle is blocked.
+	********************************************************************/
+	bool IsBlocked(int triangle) const;
+	/*!*******************************************************************
+	\brief
+		   Block or unblock every triangle overlapping given circle.
+
+	\param center
+		   Center of the circle.
+
+	\param radius
+		   Radius of the circle.
+
+	\param isBlocked
+		   True to block.
+
+	\return int
+			The number of triangles changed.
+	********************************************************************/
+	int SetBlockedInCircle(const Point& center, float radius, bool isBlocked);
+	/*!*******************************************************************
+	\brief
+		   Block or unblock every triangle overlapping given polygon.
+
+	\param polygon
+		   Vertices of convex polygon, in either order.
+
+	\param isBlocked
+		   True to block.
+
+	\return int
+			The number of triangles changed.
+	********************************************************************/
+	int SetBlockedInPolygon(const std::vector<Point>& polygon, bool isBlocked);
+	/*!*******************************************************************
+	\brief
+		   Getter method for version of the graph. It increases
+		   whenever areas, links or blocked triangles change, so paths
+		   found before can be checked again.
+
+	\return unsigned
+			Current version.
+	********************************************************************/
+	unsigned GetVersion() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for memory owned by the graph, including
+		   capacity of its containers which is not used yet.
+
+	\return size_t
+			The number of bytes.
+	********************************************************************/
+	size_t GetMemoryUsage() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for middle point of given edge.
+
+	\param triangle
+		   Index of triangle.
+
+	\param edge
+		   Index of edge.
+
+	\return const Point&
+			Middle point of the edge.
+	********************************************************************/
+	const Point& GetMidpoint(int triangle, int edge) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for vertex of triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\param index
+		   Index of vertex.
+
+	\return const Point&
+			Position of the vertex.
+	********************************************************************/
+	const Point& GetVertex(int triangle, int index) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for width of the corridor passing through given
+		   triangle between two edges other than given edge.
+
+	\param triangle
+		   Index of triangle.
+
+	\param edge
+		   Index of the third edge.
+
+	\return float
+			Width of the corridor.
+	********************************************************************/
+	float GetClearance(int triangle, int edge) const;
+	/*!*******************************************************************
+	\brief
+		   Find edge of given triangle shared with given neighbor.
+
+	\param triangle
+		   Index of triangle.
+
+	\param neighbor
+		   Index of neighbor.
+
+	\return int
+			Index of edge. -1 if they are not neighbors.
+	********************************************************************/
+	int FindEdge(int triangle, int neighbor) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for both ends of given edge, as seen from
+		   inside of given triangle.
+
+	\param triangle
+		   Index of triangle to leave.
+
+	\param edge
+		   Index of edge to go through.
+
+	\param radius
+		   Radius of agent. Edge is narrowed by it at both ends, so
+		   agent does not touch corners.
+
+	\param left
+		   Left end of edge is stored here.
+
+	\param right
+		   Right end of edge is stored here.
+	********************************************************************/
+	void GetPortal(int triangle, int edge, float radius, Point& left, Point& right) const;
+
+	/*!*******************************************************************
+	\brief
+		   Move point inside of given triangle toward given point,
+		   walking across portals. Slides along walls and blocked
+		   triangles instead of going through them.
+
+	\param triangle
+		   Triangle including start point.
+
+	\param from
+		   Start point.
+
+	\param to
+		   Destination point. Changed to the point actually reached.
+
+	\param visited
+		   If it is not null, triangles walked through are pushed into
+		   here in order, from given triangle to the returned one.
+		   Not cleared.
+
+	\return int
+			Triangle including reached point.
+	********************************************************************/
+	int MoveAlongSurface(int triangle, const Point& from, Point& to, std::vector<int>* visited = nullptr) const;
+	/*!*******************************************************************
+	\brief
+		   Walk straight from start point toward end point, across
+		   portals, until it hits a wall or blocked triangle. Only
+		   triangles crossed by the segment are visited.
+
+	\param triangle
+		   Triangle including start point.
+
+	\param start
+		   Start point of segment.
+
+	\param end
+		   End point of segment.
+
+	\param hit
+		   Where segment stopped is stored here.
+
+	\param visited
+		   If it is not null, triangles crossed are pushed into here in
+		   order. Not cleared.
+
+	\return bool
+			True if segment hits a wall before end point, so it is not
+			walkable straight.
+	********************************************************************/
+	bool Raycast(int triangle, const Point& start, const Point& end, RaycastHit& hit, std::vector<int>* visited = nullptr) const;
+
+private:
+	/*!*******************************************************************
+	\struct Links
+	\brief
+		   Everything needed to relax neighbors of one triangle.
+		   40 bytes, so mostly fits in a single cache line.
+	********************************************************************/
+	struct Links
+	{
+		int m_neighbors[3]; //!< Index of neighbor across each edge. -1 if the edge is a wall.
+		Point m_midpoints[3]; //!< Middle point of each edge.
+		unsigned char m_edges[3]; //!< Lower 2 bits are index of each edge inside of the neighbor. Upper 6 bits are area type of the neighbor.
+		unsigned char m_area; //!< Lower 7 bits are area type of this triangle. Top bit is set if off-mesh links touch it.
+	};
+	static_assert(sizeof(Links) == 40, "Links must be kept in 40 bytes.");
+
+	/*!*******************************************************************
+	\struct Bounds
+	\brief
+		   Box bounding one triangle.
+	********************************************************************/
+	struct Bounds
+	{
+		Point m_min; //!< Left bottom corner.
+		Point m_max; //!< Right top corner.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Decide order of triangles by Z-order curve of their centers,
+		   and store it into m_meshIndices.
+
+	\param meshes
+		   Navigation meshes to sort.
+	********************************************************************/
+	void SortSpatially(const std::vector<NavMeshManager::NavMesh>& meshes);
+	/*!*******************************************************************
+	\brief
+		   Put every wall edge into cells of uniform grid its bounding
+		   box overlaps.
+	********************************************************************/
+	void BuildWallGrid();
+	/*!*******************************************************************
+	\brief
+		   Change bit of given triangle in blocked set.
+
+	\param triangle
+		   Index of triangle.
+
+	\param isBlocked
+		   True to block.
+
+	\return bool
+			True if the bit changed.
+	********************************************************************/
+	bool ChangeBlocked(int triangle, bool isBlocked);
+	/*!*******************************************************************
+	\brief
+		   Label connected components by union-find over neighbors and
+		   off-mesh links, and number them from 0.
+	********************************************************************/
+	void BuildComponents();
+	/*!*******************************************************************
+	\brief
+		   Compute column or row of wall grid including given value.
+
+	\param value
+		   X or y coordinate of a point.
+
+	\param origin
+		   Same coordinate of the corner of grid.
+
+	\param count
+		   The number of columns or rows.
+
+	\return int
+			Column or row, clamped inside of grid.
+	********************************************************************/
+	int GetWallCell(float value, float origin, int count) const;
+
+private:
+	std::vector<Links> m_links; //!< Hot data for search. One for each triangle.
+	std::vector<Point> m_vertices; //!< Three vertices for each triangle.
+	std::vector<float> m_clearances; //!< Three widths of corridors for each triangle.
+	std::vector<Bounds> m_bounds; //!< Bounding box for each triangle.
+	std::vector<int> m_meshIndices; //!< Index of navigation mesh for each triangle.
+	std::vector<int> m_components; //!< Connected component of each triangle.
+	int m_componentCount = 0; //!< The number of connected components.
+
+	std::vector<OffMeshLink> m_offMeshLinks; //!< All off-mesh links.
+	std::vector<int> m_linkOffsets; //!< Links of triangle i are from m_linkIndices[m_linkOffsets[i]] to m_linkIndices[m_linkOffsets[i + 1]].
+	std::vector<int> m_linkIndices; //!< Index of links sorted by triangle. Link appears at both of its triangles.
+	float m_minLinkCostRatio = 1.f; //!< The smallest ratio of cost to distance among links.
+
+	std::vector<unsigned> m_blocked; //!< One bit for each triangle, set if it is blocked.
+	unsigned m_version = 0; //!< Increased whenever search result may change.
+
+	Point m_wallOrigin; //!< Left bottom corner of wall grid.
+	float m_wallCellSize = 1.f; //!< Width and height of each cell of wall grid.
+	int m_wallColumns = 0; //!< The number of columns of wall grid.
+	int m_wallRows = 0; //!< The number of rows of wall grid.
+	std::vector<int> m_wallOffsets; //!< Walls of cell i are from m_walls[m_wallOffsets[i]] to m_walls[m_wallOffsets[i + 1]].
+	std::vector<int> m_walls; //!< Wall edges sorted by cell, as triangle * 3 + edge.
+};
+
+#endif // !NAVGRAPH_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <queue>
 #include <stack>
 #include <algorithm>
+#include <chrono>
 
 #include "NavMeshManager.h"
 
@@ -16,17 +17,26 @@ void NavMeshManager::Generate(std::vector<Vertex>& vertices)
 {
 	m_vertices = std::move(vertices);
 
-	LabelVertices();
+	m_stats = GenerateStats();
+	m_stats.m_vertices = static_cast<int>(m_vertices.size());
 
-	PartitionIntoMonotone();
+	RunStage(LabelVerticesStage, &NavMeshManager::LabelVertices);
 
-	OrganizePieces();
+	RunStage(PartitionIntoMonotoneStage, &NavMeshManager::PartitionIntoMonotone);
+	m_stats.m_monotoneDiagonals = static_cast<int>(m_diagonals.size());
 
-	LabelLeftRight();
+	RunStage(OrganizePiecesStage, &NavMeshManager::OrganizePieces);
+	m_stats.m_pieces = static_cast<int>(m_pieces.size());
 
-	TriangulatePieces();
+	RunStage(LabelLeftRightStage, &NavMeshManager::LabelLeftRight);
 
-	SetNeighborForMesh();
+	RunStage(TriangulatePiecesStage, &NavMeshManager::TriangulatePieces);
+	m_stats.m_triangulationDiagonals = static_cast<int>(m_diagonals.size()) - m_stats.m_monotoneDiagonals;
+	m_stats.m_triangles = static_cast<int>(m_triangles.size());
+
+	RunStage(SetNeighborForMeshStage, &NavMeshManager::SetNeighborForMesh);
+
+	RunStage(ComputeClearanceStage, &NavMeshManager::ComputeClearance);
 }
 
 void NavMeshManager::SetColor(const Color& color)
@@ -50,6 +60,46 @@ std::vector<NavMeshManager::NavMesh>& NavMeshManager::GetNavMeshes()
 	return m_triangles;
 }
 
+const NavMeshManager::GenerateStats& NavMeshManager::GetStats() const
+{
+	return m_stats;
+}
+
+void NavMeshManager::SetStageCallback(StageCallback callback)
+{
+	m_stageCallback = std::move(callback);
+}
+
+const char* NavMeshManager::GetStageName(Stage stage)
+{
+	static const char* const names[StageCount] = {
+		"LabelVertices",
+		"PartitionIntoMonotone",
+		"OrganizePieces",
+		"LabelLeftRight",
+		"TriangulatePieces",
+		"SetNeighborForMesh",
+		"ComputeClearance"
+	};
+
+	return names[stage];
+}
+
+void NavMeshManager::RunStage(Stage stage, void (NavMeshManager::*method)())
+{
+	using Clock = std::chrono::steady_clock;
+	const auto begin = Clock::now();
+
+	(this->*method)();
+
+	const std::chrono::duration<float, std::micro> elapsed = Clock::now() - begin;
+	m_stats.m_stageMicroseconds[stage] = elapsed.count();
+	m_stats.m_totalMicroseconds += elapsed.count();
+
+	if (m_stageCallback)
+		m_stageCallback(stage, m_stats);
+}
+
 /*!*******************************************************************
 \struct Compare
 \brief
@@ -162,6 +212,8 @@ void NavMeshManager::PartitionIntoMonotone()
 			HandleRegularVertex(vertex, bt);
 			break;
 		}
+
+		m_stats.m_maxStatusSize = std::max(m_stats.m_maxStatusSize, bt.Size());
 	}
 }
 
@@ -541,6 +593,7 @@ void NavMeshManager::SetNeighborForMesh()
 			for (size_t i = 0; i < size; ++i)
 			{
 				auto& edge = edges[i];
+				++m_stats.m_neighborTests;
 
 				if (edge == diagonal || // Check reversed case too.
 					(edge.m_start == diagonal.m_end && edge.m_end == diagonal.m_start))
@@ -564,4 +617,71 @@ void NavMeshManager::SetNeighborForMesh()
 
 	Continue:;
 	}
+}
+
+void NavMeshManager::ComputeClearance()
+{
+	std::vector<int> visited(m_triangles.size(), -1);
+	int stamp = 0;
+
+	for (auto& mesh : m_triangles)
+	{
+		const int size = static_cast<int>(mesh.m_edges.size());
+		mesh.m_clearances.resize(size);
+
+		for (int i = 0; i < size; ++i)
+			mesh.m_clearances[i] = ComputeWidth(mesh, i, visited, stamp++);
+	}
+}
+
+float NavMeshManager::ComputeWidth(const NavMesh& mesh, int index, std::vector<int>& visited, int stamp) const
+{
+	// Vertex shared by other two edges.
+	const Point& vertex = mesh.m_edges[(index + 1) % mesh.m_edges.size()].m_end;
+	const auto& third = mesh.m_edges[index];
+
+	// Corridor cannot be wider than both edges, since all vertices are corners of obstacles.
+	float width = std::min(DistanceBetween(vertex, third.m_start), DistanceBetween(vertex, third.m_end));
+
+	// Edges to cross. Pair of mesh and index of edge.
+	std::stack<std::pair<const NavMesh*, int>> edges;
+	edges.push(std::make_pair(&mesh, index));
+
+	while (!edges.empty())
+	{
+		const NavMesh* curr = edges.top().first;
+		const int i = edges.top().second;
+		edges.pop();
+
+		// Obstacles behind this edge are farther than current width.
+		const auto& edge = curr->m_edges[i];
+		const float distance = DistanceToSegment(vertex, edge.m_start, edge.m_end);
+		if (distance >= width) continue;
+
+		// Wall is closer than current width.
+		const NavMesh* next = curr->m_neighbors[i];
+		if (next == nullptr)
+		{
+			width = distance;
+			continue;
+		}
+
+		int& stampOfNext = visited[next - m_triangles.data()];
+		if (stampOfNext == stamp) continue;
+		stampOfNext = stamp;
+
+		// Find shared edge in next mesh. Vertex not on that edge is corner of obstacle too.
+		const int size = static_cast<int>(next->m_edges.size());
+		int shared = 0;
+		while (next->m_neighbors[shared] != curr)
+			++shared;
+
+		width = std::min(width, DistanceBetween(vertex, next->m_edges[(shared + 1) % size].m_end));
+
+		// Keep looking across other edges of next mesh.
+		edges.push(std::make_pair(next, (shared + 1) % size));
+		edges.push(std::make_pair(next, (shared + 2) % size));
+	}
+
+	return width;
 }
\ No newline at end of file
@@ -12,13 +12,13 @@
 
 #include <vector>
 #include <list>
+#include <functional>
 
 #include "Point.h"
 #include "Color.h"
 #include "BinaryTree.h"
 
 class Render;
-struct Node;
 
 /*!*******************************************************************
 \class NavMeshManager
@@ -123,9 +123,48 @@ public:
 	{
 		std::vector<Edge> m_edges; //!< Container for edges of this navmesh.
 		std::vector<NavMesh*> m_neighbors; //!< Container for pointer to meshes adjacent to each edge.
-		Node* m_node = nullptr; //!< Will be used for A* pathfinding. Pointer to node which attached to this navmesh.
+		std::vector<float> m_clearances; //!< For each edge, width of the corridor passing through this triangle between the other two edges.
 	};
 
+	/*!*******************************************************************
+	\enum Stage
+	\brief
+		   Stages of Generate, in order they run.
+	********************************************************************/
+	enum Stage
+	{
+		LabelVerticesStage,
+		PartitionIntoMonotoneStage,
+		OrganizePiecesStage,
+		LabelLeftRightStage,
+		TriangulatePiecesStage,
+		SetNeighborForMeshStage,
+		ComputeClearanceStage,
+		StageCount
+	};
+
+	/*!*******************************************************************
+	\struct GenerateStats
+	\brief
+		   Time of each stage and sizes of the last generation. Kept
+		   small, so it is always collected.
+	********************************************************************/
+	struct GenerateStats
+	{
+		float m_stageMicroseconds[StageCount] = {}; //!< Time taken by each stage.
+		float m_totalMicroseconds = 0.f; //!< Time taken by all stages.
+
+		int m_vertices = 0; //!< The number of vertices of boundary and holes.
+		int m_monotoneDiagonals = 0; //!< The number of diagonals added to split polygon into monotone pieces.
+		int m_triangulationDiagonals = 0; //!< The number of diagonals added to triangulate pieces.
+		int m_pieces = 0; //!< The number of monotone pieces.
+		int m_triangles = 0; //!< The number of generated navigation meshes.
+		int m_maxStatusSize = 0; //!< The biggest number of edges crossing scan line at once.
+		long long m_neighborTests = 0; //!< The number of edges compared to diagonals to find neighbors.
+	};
+
+	using StageCallback = std::function<void(Stage stage, const GenerateStats& stats)>;
+
 public:
 	/*!*******************************************************************
 	\brief
@@ -166,7 +205,50 @@ public:
 	********************************************************************/
 	std::vector<NavMesh>& GetNavMeshes();
 
+	/*!*******************************************************************
+	\brief
+		   Getter method for statistics of the last generation.
+
+	\return const GenerateStats&
+			Time and sizes of each stage.
+	********************************************************************/
+	const GenerateStats& GetStats() const;
+	/*!*******************************************************************
+	\brief
+		   Setter method for function called after each stage of
+		   Generate, on the thread calling Generate.
+
+	\param callback
+		   Called with finished stage and statistics so far. Can be
+		   empty.
+	********************************************************************/
+	void SetStageCallback(StageCallback callback);
+	/*!*******************************************************************
+	\brief
+		   Getter method for name of given stage.
+
+	\param stage
+		   Stage of Generate.
+
+	\return const char*
+			Name of method running the stage.
+	********************************************************************/
+	static const char* GetStageName(Stage stage);
+
 private:
+	/*!*******************************************************************
+	\brief
+		   Run one stage of Generate, measure it and report it to the
+		   callback.
+
+	\param stage
+		   Stage to run.
+
+	\param method
+		   Method running the stage.
+	********************************************************************/
+	void RunStage(Stage stage, void (NavMeshManager::*method)());
+
 	/*!*******************************************************************
 	\brief
 		   Before execute partitioning into monotone pieces algorithm,
@@ -343,11 +425,45 @@ private:
 	********************************************************************/
 	void SetNeighborForMesh();
 
+	/*!*******************************************************************
+	\brief
+		   After setting neighbors, compute clearance of each triangle,
+		   so agents of any size can use the same navigation meshes.
+	********************************************************************/
+	void ComputeClearance();
+	/*!*******************************************************************
+	\brief
+		   Helper method for computing clearance.
+		   Corridor between two edges sharing a vertex is bounded by that
+		   vertex and the obstacles behind the third edge. Walk across
+		   the third edge to find the closest obstacle to the vertex.
+
+	\param mesh
+		   Triangle to compute.
+
+	\param index
+		   Index of the third edge, which does not include the vertex.
+
+	\param visited
+		   Stamps of triangles already checked, so each triangle is
+		   checked only once for each corridor.
+
+	\param stamp
+		   Stamp for this corridor.
+
+	\return float
+			Width of the corridor.
+	********************************************************************/
+	float ComputeWidth(const NavMesh& mesh, int index, std::vector<int>& visited, int stamp) const;
+
 private:
 	std::vector<Vertex> m_vertices; //!< Container for vertices from original geography.
 	std::list<Edge> m_diagonals; //!< Conatiner for new diagonals added by algorithm.
 	std::list<std::vector<Vertex>> m_pieces; //!< Container for monotone pieces. Each piece has the vector of vertices.
 	std::vector<NavMesh> m_triangles; //!< Container of generated navigation meshes.
+
+	GenerateStats m_stats; //!< Statistics of the last generation.
+	StageCallback m_stageCallback; //!< Called after each stage.
 	
 	Color m_color = GRAY; //!< Color of navigation meshes.
 };
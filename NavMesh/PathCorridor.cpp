@@ -0,0 +1,290 @@
+/*!*******************************************************************
+\file		  PathCorridor.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <algorithm>
+
+#include "PathCorridor.h"
+
+namespace
+{
+	const int MaxMergeSearch = 32; //!< The number of triangles from each end searched to join walked triangles.
+}
+
+void PathCorridor::Reset(const NavGraph& graph, int triangle, const Point& position, float radius)
+{
+	m_graph = &graph;
+	m_radius = radius;
+	m_position = position;
+	m_target = position;
+
+	m_triangles.clear();
+	m_triangles.push_back(triangle);
+}
+
+void PathCorridor::SetCorridor(const Point& target, const std::vector<int>& triangles)
+{
+	m_target = target;
+	m_triangles.assign(triangles.rbegin(), triangles.rend());
+}
+
+const Point& PathCorridor::MovePosition(const Point& position)
+{
+	if (m_triangles.empty()) return m_position;
+
+	Point reached = position;
+	m_visited.clear();
+	m_graph->MoveAlongSurface(GetFirstTriangle(), m_position, reached, &m_visited);
+
+	// Find the last walked triangle, which is also near the front of corridor.
+	// The first walked one is the front itself, so it always ends.
+	const int size = static_cast<int>(m_triangles.size());
+	const int window = std::min(size, MaxMergeSearch);
+
+	int walked = static_cast<int>(m_visited.size()) - 1;
+	int trimmed = 0;
+
+	for (; walked > 0; --walked)
+	{
+		for (trimmed = 0; trimmed < window; ++trimmed)
+		{
+			if (m_triangles[size - 1 - trimmed] == m_visited[walked]) break;
+		}
+
+		if (trimmed < window) break;
+	}
+
+	if (walked == 0)
+		trimmed = 0;
+
+	// Drop passed triangles, and add walked ones after that triangle to the front.
+	m_triangles.resize(size - trimmed);
+	m_triangles.insert(m_triangles.end(), m_visited.begin() + walked + 1, m_visited.end());
+
+	m_position = reached;
+	return m_position;
+}
+
+bool PathCorridor::MoveTarget(const Point& target)
+{
+	if (m_triangles.empty()) return false;
+
+	Point reached = target;
+	m_visited.clear();
+	m_graph->MoveAlongSurface(GetLastTriangle(), m_target, reached, &m_visited);
+
+	// Same as MovePosition, from the other end.
+	const int size = static_cast<int>(m_triangles.size());
+	const int window = std::min(size, MaxMergeSearch);
+
+	int walked = static_cast<int>(m_visited.size()) - 1;
+	int trimmed = 0;
+
+	for (; walked > 0; --walked)
+	{
+		for (trimmed = 0; trimmed < window; ++trimmed)
+		{
+			if (m_triangles[trimmed] == m_visited[walked]) break;
+		}
+
+		if (trimmed < window) break;
+	}
+
+	if (walked == 0)
+		trimmed = 0;
+
+	m_triangles.erase(m_triangles.begin(), m_triangles.begin() + trimmed);
+	m_triangles.insert(m_triangles.begin(), m_visited.rbegin(), m_visited.rend() - walked - 1);
+
+	m_target = reached;
+	return reached == target;
+}
+
+int PathCorridor::FindCorners(std::vector<Point>& corners, int maxCorners)
+{
+	corners.clear();
+	m_portalLefts.clear();
+	m_portalRights.clear();
+
+	if (m_triangles.empty() || maxCorners <= 0)
+		return 0;
+
+	// Portals between triangles, and target at last.
+	const int size = GetTriangleCount();
+
+	int leftIndex = 0;
+	int rightIndex = 0;
+
+	ExtendPortals(0);
+
+	Point corner = m_position;
+	Point portalLeft = m_portalLefts[0];
+	Point portalRight = m_portalRights[0];
+
+	for (int i = 1; i < size; ++i)
+	{
+		// Portals are computed only as far as funnel goes.
+		ExtendPortals(i);
+
+		const Point left = m_portalLefts[i];
+		const Point right = m_portalRights[i];
+
+		// Update right vertex of edge
+		if (right != portalRight)
+		{
+			// If new vertex can tighten the funnel,
+			if (TriArea(corner, portalRight, right) <= 0.f)
+			{
+				// portalRight just needs to be updated OR new vertex does not go over opposite side
+				if (corner == portalRight || TriArea(corner, portalLeft, right) > 0.f)
+				{
+					portalRight = right; // Tighten the funnel.
+					rightIndex = i;
+				}
+				else // Right over left.
+				{
+					// Left becomes new corner.
+					corner = portalLeft;
+					corners.push_back(corner);
+
+					if (static_cast<int>(corners.size()) >= maxCorners)
+						return maxCorners;
+
+					// Start from new corner
+					i = leftIndex;
+
+					++leftIndex;
+					rightIndex = leftIndex;
+
+					if (leftIndex >= size) break;
+
+					portalLeft = m_portalLefts[leftIndex];
+					portalRight = m_portalRights[rightIndex];
+
+					continue; // Not update left this time
+				}
+			}
+		}
+
+		// Update left vertex
+		if (left != portalLeft)
+		{
+			// If new vertex can tighten the funnel,
+			if (TriArea(corner, portalLeft, left) >= 0.f)
+			{
+				// portalLeft just needs to be updated OR new vertex does not go over opposite side
+				if (corner == portalLeft || TriArea(corner, portalRight, left) < 0.f)
+				{
+					portalLeft = left; // Tighten the funnel.
+					leftIndex = i;
+				}
+				else // Left over right.
+				{
+					// Right becomes new corner.
+					corner = portalRight;
+					corners.push_back(corner);
+
+					if (static_cast<int>(corners.size()) >= maxCorners)
+						return maxCorners;
+
+					// Start from new corner
+					i = rightIndex;
+
+					++rightIndex;
+					leftIndex = rightIndex;
+
+					if (leftIndex >= size) break;
+
+					portalLeft = m_portalLefts[leftIndex];
+					portalRight = m_portalRights[rightIndex];
+				}
+			}
+		}
+	}
+
+	// Target is always the last corner.
+	if (corners.empty() || corners.back() != m_target)
+		corners.push_back(m_target);
+
+	return static_cast<int>(corners.size());
+}
+
+bool PathCorridor::IsValid(int maxLookAhead) const
+{
+	if (m_triangles.empty()) return false;
+
+	const int size = GetTriangleCount();
+	const int count = std::min(size, maxLookAhead);
+
+	for (int i = 0; i < count; ++i)
+	{
+		const int triangle = GetTriangle(i);
+		if (triangle < 0 || triangle >= m_graph->GetTriangleCount())
+			return false;
+
+		// Must be able to go to the next one. Position may stay in blocked triangle, but cannot enter one.
+		if (i + 1 < size && m_graph->FindEdge(triangle, GetTriangle(i + 1)) < 0)
+			return false;
+
+		if (i > 0 && m_graph->IsBlocked(triangle))
+			return false;
+	}
+
+	return true;
+}
+
+const Point& PathCorridor::GetPosition() const
+{
+	return m_position;
+}
+
+const Point& PathCorridor::GetTarget() const
+{
+	return m_target;
+}
+
+int PathCorridor::GetFirstTriangle() const
+{
+	return m_triangles.empty() ? -1 : m_triangles.back();
+}
+
+int PathCorridor::GetLastTriangle() const
+{
+	return m_triangles.empty() ? -1 : m_triangles.front();
+}
+
+int PathCorridor::GetTriangleCount() const
+{
+	return static_cast<int>(m_triangles.size());
+}
+
+int PathCorridor::GetTriangle(int index) const
+{
+	return m_triangles[m_triangles.size() - 1 - index];
+}
+
+void PathCorridor::ExtendPortals(int index)
+{
+	const int last = GetTriangleCount() - 1;
+
+	for (int i = static_cast<int>(m_portalLefts.size()); i <= index; ++i)
+	{
+		Point left = m_target;
+		Point right = m_target;
+
+		// Broken corridor goes straight to target. IsValid tells it to caller.
+		if (i < last)
+		{
+			const int triangle = GetTriangle(i);
+			const int edge = m_graph->FindEdge(triangle, GetTriangle(i + 1));
+
+			if (edge >= 0)
+				m_graph->GetPortal(triangle, edge, m_radius, left, right);
+		}
+
+		m_portalLefts.push_back(left);
+		m_portalRights.push_back(right);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+/*!*******************************************************************
+\headerfile   PathCorridor.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for PathCorridor class which keeps
+			  triangles of a path while its ends move.
+********************************************************************/
+#ifndef PATHCORRIDOR_H
+#define PATHCORRIDOR_H
+
+#include <vector>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+
+/*!*******************************************************************
+\class PathCorridor
+\brief
+	   Sequence of triangles from current position to target. When
+	   either end moves, the corridor is fixed by short walk on the
+	   surface instead of new search, so cost of each move depends
+	   on how far it went, not on the length of path.
+	   Corners are found by funnel algorithm over the corridor only,
+	   and it stops once enough corners are found.
+********************************************************************/
+class PathCorridor
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Make corridor of single triangle, which has both position
+		   and target at given point.
+
+	\param graph
+		   Graph to walk on. Must not be moved or changed while this
+		   corridor uses it.
+
+	\param triangle
+		   Triangle including position.
+
+	\param position
+		   Current position.
+
+	\param radius
+		   Radius of agent. Corners keep this distance from walls.
+	********************************************************************/
+	void Reset(const NavGraph& graph, int triangle, const Point& position, float radius);
+	/*!*******************************************************************
+	\brief
+		   Replace the corridor with path found by search.
+
+	\param target
+		   Destination point. Must be inside of the last triangle.
+
+	\param triangles
+		   Triangles of path from the one including current position
+		   to the one including target, like
+		   PathQuery::GetPathTriangles.
+	********************************************************************/
+	void SetCorridor(const Point& target, const std::vector<int>& triangles);
+
+	/*!*******************************************************************
+	\brief
+		   Move position toward given point along the surface.
+		   Triangles passed are trimmed from the front, and triangles
+		   outside of corridor are added to the front.
+
+	\param position
+		   Point to move to. Position stops at walls.
+
+	\return const Point&
+			Position actually reached.
+	********************************************************************/
+	const Point& MovePosition(const Point& position);
+	/*!*******************************************************************
+	\brief
+		   Move target toward given point along the surface, fixing
+		   the end of corridor same as MovePosition.
+
+	\param target
+		   Point to move to.
+
+	\return bool
+			False if target could not reach given point. It was moved
+			too far or blocked by walls, so path must be found again.
+	********************************************************************/
+	bool MoveTarget(const Point& target);
+
+	/*!*******************************************************************
+	\brief
+		   Find corners of straight path along the corridor, from
+		   position toward target.
+
+	\param corners
+		   Corners are stored here. The last one is target, if it is
+		   found before the limit.
+
+	\param maxCorners
+		   The number of corners to find. Funnel stops there, so
+		   portals beyond them are never read.
+
+	\return int
+			The number of corners found.
+	********************************************************************/
+	int FindCorners(std::vector<Point>& corners, int maxCorners);
+	/*!*******************************************************************
+	\brief
+		   Check whether triangles near the front are still connected
+		   and not blocked, so the corridor can be followed.
+
+	\param maxLookAhead
+		   The number of triangles to check from the front.
+
+	\return bool
+			False if path must be found again.
+	********************************************************************/
+	bool IsValid(int maxLookAhead) const;
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for current position.
+
+	\return const Point&
+			Position at the front of corridor.
+	********************************************************************/
+	const Point& GetPosition() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for target.
+
+	\return const Point&
+			Target at the end of corridor.
+	********************************************************************/
+	const Point& GetTarget() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for triangle including position.
+
+	\return int
+			Index of the first triangle. -1 if corridor is empty.
+	********************************************************************/
+	int GetFirstTriangle() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for triangle including target.
+
+	\return int
+			Index of the last triangle. -1 if corridor is empty.
+	********************************************************************/
+	int GetLastTriangle() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of triangles in the corridor.
+
+	\return int
+			The number of triangles.
+	********************************************************************/
+	int GetTriangleCount() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for triangle of the corridor.
+
+	\param index
+		   Index from the front. 0 is the triangle including position.
+
+	\return int
+			Index of triangle.
+	********************************************************************/
+	int GetTriangle(int index) const;
+
+private:
+	/*!*******************************************************************
+	\brief
+		   Compute portals until given index, after those computed
+		   already. Portal i is between triangle i and i + 1, and the
+		   last one is target.
+
+	\param index
+		   Index of portal needed.
+	********************************************************************/
+	void ExtendPortals(int index);
+
+private:
+	const NavGraph* m_graph = nullptr; //!< Graph to walk on. Only read.
+	float m_radius = 0.f; //!< Radius of agent.
+	Point m_position; //!< Current position.
+	Point m_target; //!< Destination point.
+
+	std::vector<int> m_triangles; //!< Triangles of corridor in reverse order, so position moves at the back cheaply.
+	std::vector<int> m_visited; //!< Triangles walked through by the last move. Reused for every move.
+	std::vector<Point> m_portalLefts; //!< Left vertices of portals computed by the last funnel.
+	std::vector<Point> m_portalRights; //!< Right vertices of portals computed by the last funnel.
+};
+
+#endif // !PATHCORRIDOR_H
\ No newline at end of file
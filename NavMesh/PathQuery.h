@@ -0,0 +1,580 @@
+/*!*******************************************************************
+\headerfile   PathQuery.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for BasicPathQuery class which runs A*
+			  search on navigation meshes step by step.
+********************************************************************/
+#ifndef PATHQUERY_H
+#define PATHQUERY_H
+
+#include <vector>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "QueryFilter.h"
+#include "BinaryHeap.h"
+#include "SearchContext.h"
+#include "SearchPolicies.h"
+#include "SearchTrace.h"
+#include "SearchStats.h"
+
+/*!*******************************************************************
+\class BasicPathQuery
+\brief
+	   Resumable A* search between start point and end point.
+	   Open list and nodes are kept between calls of Step, so
+	   expensive search can be spread across several frames.
+	   Heuristic, cost model and open list are types, so expansion
+	   of each combination is compiled with all of them inlined.
+	   Trace is chosen by Step the same way.
+
+\tparam Heuristic
+		Estimates cost to start point, like OctileHeuristic.
+
+\tparam CostModel
+		Decides passability and cost of area types from filter, like
+		FilterCost.
+
+\tparam OpenList
+		Priority queue of open nodes, like BinaryHeap.
+********************************************************************/
+template <class Heuristic, class CostModel, class OpenList>
+class BasicPathQuery
+{
+public:
+	/*!*******************************************************************
+	\enum Status
+	\brief
+		   Result of the search so far.
+	********************************************************************/
+	enum class Status
+	{
+		Pending,
+		Found,
+		NoPath
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Set graph to search on and initialize all nodes.
+		   Graph must not be moved or changed while this query uses it.
+
+	\param graph
+		   Graph of navigation meshes of current map.
+	********************************************************************/
+	void Initialize(const NavGraph& graph);
+
+	/*!*******************************************************************
+	\brief
+		   Setter method for start point.
+		   Search is rooted at the end point, so nodes closed by previous
+		   search are still valid. Next step resumes previous search
+		   instead of searching newly, if end point and weight have not
+		   changed.
+
+	\param start
+		   New start point.
+	********************************************************************/
+	void SetStart(const Point& start);
+	/*!*******************************************************************
+	\brief
+		   Setter method for end point.
+		   Next step starts new search.
+
+	\param end
+		   New end point.
+	********************************************************************/
+	void SetEnd(const Point& end);
+	/*!*******************************************************************
+	\brief
+		   Setter method for weight.
+		   Previous search cannot be resumed after weight changed.
+
+	\param weight
+		   New weight.
+	********************************************************************/
+	void SetWeight(float weight);
+	/*!*******************************************************************
+	\brief
+		   Setter method for radius of agent.
+		   Portals narrower than the agent are not used, and path keeps
+		   distance from corners of obstacles by the radius.
+		   Previous search cannot be resumed after radius changed.
+
+	\param radius
+		   New radius.
+	********************************************************************/
+	void SetRadius(float radius);
+	/*!*******************************************************************
+	\brief
+		   Setter method for distance start and end points can be moved
+		   onto the graph. Points outside of polygons within this
+		   distance are moved to the closest point on the graph, so
+		   path is still found. 0 by default.
+
+	\param snapRadius
+		   New distance.
+	********************************************************************/
+	void SetSnapRadius(float snapRadius);
+	/*!*******************************************************************
+	\brief
+		   Setter method for filter deciding cost and passability of
+		   area types. Heuristic is scaled by the smallest cost of the
+		   filter, so path stays optimal with weight 1.
+		   Previous search cannot be resumed after filter changed.
+
+	\param filter
+		   New filter. Copied.
+	********************************************************************/
+	void SetFilter(const QueryFilter& filter);
+	/*!*******************************************************************
+	\brief
+		   Setter method for heuristic. Landmark heuristic must be built
+		   for the graph of this query.
+		   Previous search cannot be resumed after heuristic changed.
+
+	\param heuristic
+		   New heuristic. Copied.
+	********************************************************************/
+	void SetHeuristic(const Heuristic& heuristic);
+	/*!*******************************************************************
+	\brief
+		   Turn on anytime search. First path is found with given
+		   weight, and Improve lowers it step by step to the weight of
+		   SetWeight, reusing the search tree each time. Off if initial
+		   weight is not greater than that weight.
+		   Previous search cannot be resumed after this changed.
+
+	\param initialWeight
+		   Weight for the first path.
+
+	\param weightStep
+		   How much weight decreases for each improvement. If it is not
+		   positive, the second path uses the final weight at once.
+	********************************************************************/
+	void SetAnytime(float initialWeight, float weightStep);
+
+	/*!*******************************************************************
+	\brief
+		   Keep searching until path is found, there is no path, or
+		   budget runs out. Finished result is returned again, unless
+		   graph changed after it was found. Then search starts again.
+
+	\param maxNodes
+		   The number of nodes can be expanded in this call.
+		   If it is negative, there is no limit.
+
+	\param maxMicroseconds
+		   Time this call can take. Checked after each expansion.
+		   If it is negative, there is no limit.
+
+	\return Status
+			Pending if budget ran out before search finished.
+			Otherwise, Found or NoPath.
+	********************************************************************/
+	Status Step(int maxNodes = -1, float maxMicroseconds = -1.f);
+	/*!*******************************************************************
+	\brief
+		   Same as above, but records touched nodes into given trace.
+		   Trace is cleared when new search starts, and keeps records
+		   while search is resumed.
+
+	\param trace
+		   Trace policy. NullTrace, RingTrace or FullTrace.
+
+	\param maxNodes
+		   The number of nodes can be expanded in this call.
+		   If it is negative, there is no limit.
+
+	\param maxMicroseconds
+		   Time this call can take. Checked after each expansion.
+		   If it is negative, there is no limit.
+
+	\return Status
+			Pending if budget ran out before search finished.
+			Otherwise, Found or NoPath.
+	********************************************************************/
+	template <class Trace>
+	Status Step(Trace& trace, int maxNodes = -1, float maxMicroseconds = -1.f);
+	/*!*******************************************************************
+	\brief
+		   Improve found path of anytime search. Each pass lowers
+		   weight, expands only nodes whose cost got lower, and replaces
+		   path when it finishes. Passes continue until budget runs out
+		   or weight reaches the final one. Path found before is kept
+		   while a pass is not finished.
+
+	\param maxNodes
+		   The number of nodes can be expanded in this call.
+		   If it is negative, there is no limit.
+
+	\param maxMicroseconds
+		   Time this call can take. Checked after each expansion.
+		   If it is negative, there is no limit.
+
+	\return Status
+			Status of the search. Found unless start or end point
+			changed after path was found.
+	********************************************************************/
+	Status Improve(int maxNodes = -1, float maxMicroseconds = -1.f);
+	/*!*******************************************************************
+	\brief
+		   Getter method for bound of current path. Cost of path is not
+		   greater than cost of optimal path times this.
+
+	\return float
+			Weight used by the last finished pass, or 1 if it was not
+			greater than 1.
+	********************************************************************/
+	float GetSuboptimalityBound() const;
+	/*!*******************************************************************
+	\brief
+		   Check whether Improve can make path better.
+
+	\return bool
+			True if path is found by anytime search, and weight has not
+			reached the final one.
+	********************************************************************/
+	bool CanImprove() const;
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for status of the search.
+
+	\return Status
+			Result of the last step. Pending if start or end point
+			has been changed after that.
+	********************************************************************/
+	Status GetStatus() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for version of graph the last result was found
+		   on. If it differs from NavGraph::GetVersion, the path may go
+		   through blocked triangles, and next step searches again.
+
+	\return unsigned
+			Version of graph of the last search.
+	********************************************************************/
+	unsigned GetGraphVersion() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for start point.
+
+	\return const Point&
+			Beginning point of path. Moved onto the graph if it was
+			outside.
+	********************************************************************/
+	const Point& GetStart() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for end point.
+
+	\return const Point&
+			Destination point of path. Moved onto the graph if it was
+			outside.
+	********************************************************************/
+	const Point& GetEnd() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for found path.
+
+	\return const std::vector<Point>&
+			Points where path enters each node, from start node to end
+			node. Empty unless status is Found.
+	********************************************************************/
+	const std::vector<Point>& GetPath() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for triangles of found path.
+
+	\return const std::vector<int>&
+			Index of triangles of graph, from start node to end node.
+			Empty unless status is Found.
+	********************************************************************/
+	const std::vector<int>& GetPathTriangles() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for cost of found path, through points of
+		   GetPath from start point to end point.
+
+	\return float
+			Distance walked inside of each triangle times its cost,
+			plus cost of off-mesh links. 0 unless status is Found.
+	********************************************************************/
+	float GetPathCost() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for smoothen path.
+
+	\return const std::vector<Point>&
+			Corners of path between start point and end point.
+			Empty unless status is Found.
+	********************************************************************/
+	const std::vector<Point>& GetSmoothPath() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for off-mesh links of smoothen path.
+
+	\return const std::vector<int>&
+			For each corner of smoothen path, index of off-mesh link
+			taken to arrive there from the previous corner, or -1 if
+			agent walks. Both ends of a link are corners.
+	********************************************************************/
+	const std::vector<int>& GetSmoothPathLinks() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for statistics of current query. Reset when
+		   new search starts or previous one is resumed, and keeps
+		   counting through Step and Improve until then.
+
+	\return const SearchStats&
+			Work done for current start and end points. All zero if
+			statistics are compiled out.
+	********************************************************************/
+	const SearchStats& GetStats() const;
+
+private:
+	/*!*******************************************************************
+	\brief
+		   Clear previous search and push end node into open list.
+
+	\return bool
+			False if one of points is not inside of polygon.
+	********************************************************************/
+	bool BeginSearch();
+	/*!*******************************************************************
+	\brief
+		   Prepare to reuse the search tree rooted at the end point after
+		   start point moved. Update costs of open list with new
+		   heuristic.
+
+	\return Status
+			Found if new start node is already closed, NoPath if start
+			point is not inside of polygon, Pending otherwise.
+	********************************************************************/
+	Status ResumeSearch();
+	/*!*******************************************************************
+	\brief
+		   Expand nodes until start node gets final cost of this pass,
+		   or budget runs out.
+
+	\param trace
+		   Trace to record touched nodes.
+
+	\param maxNodes
+		   The number of nodes can be expanded.
+		   If it is negative, there is no limit.
+
+	\param maxMicroseconds
+		   Time this can take. If it is negative, there is no limit.
+
+	\param expanded
+		   The number of expanded nodes is added to here.
+
+	\return Status
+			Found if path is restored, NoPath if every reachable node is
+			closed, Pending if budget ran out.
+	********************************************************************/
+	template <class Trace>
+	Status Search(Trace& trace, int maxNodes, float maxMicroseconds, int& expanded);
+	/*!*******************************************************************
+	\brief
+		   Start next pass of anytime search. Weight decreases, nodes
+		   improved after closed are opened again, and every node can
+		   be closed again.
+	********************************************************************/
+	void BeginPass();
+	/*!*******************************************************************
+	\brief
+		   Close node has the lowest cost and push its neighbors into
+		   open list.
+
+	\param trace
+		   Trace to record touched nodes.
+
+	\return int
+			Index of closed node.
+	********************************************************************/
+	template <class Trace>
+	int ExpandNode(Trace& trace);
+	/*!*******************************************************************
+	\brief
+		   Check whether agent can pass through given triangle from
+		   given edge to the other given edge.
+
+	\param triangle
+		   Index of triangle to pass through.
+
+	\param entry
+		   Index of edge agent comes in.
+
+	\param exit
+		   Index of edge agent goes out. If it is negative, agent stops
+		   inside of this triangle.
+
+	\return bool
+			True if corridor between two edges is wide enough.
+	********************************************************************/
+	bool IsWideEnough(int triangle, int entry, int exit) const;
+	/*!*******************************************************************
+	\brief
+		   Check whether new parent is better for given node. Anytime
+		   search also needs lower given cost. Nodes having children are
+		   updated there, and heuristic at moved origin could make
+		   parent cycles otherwise.
+
+	\param node
+		   Node touched by current search.
+
+	\param status
+		   Status of the node.
+
+	\param given
+		   Given cost through new parent.
+
+	\param cost
+		   Total cost through new parent.
+
+	\return bool
+			True if node should take new parent.
+	********************************************************************/
+	bool IsImprovement(const SearchNode& node, SearchNode::Status status, float given, float cost) const;
+	/*!*******************************************************************
+	\brief
+		   Follow parents from start node to end node, store them as path
+		   with left and right vertices of portals between them, and
+		   smooth it.
+	********************************************************************/
+	void RestorePath();
+
+	// Helper functions for A*
+	/*!*******************************************************************
+	\brief
+		   Find triangle that include given position. Position outside
+		   of polygons is moved onto the graph within snap radius.
+
+	\param position
+		   Point to check. Changed to the point path uses.
+
+	\return int
+			Index of triangle corresponding to given point.
+			-1 if point is not inside of any.
+	********************************************************************/
+	int GetTriangle(Point& position) const;
+	/*!*******************************************************************
+	\brief
+		   Compute the point where path comes to given node. Simply, it
+		   is the middle point of the edge which this node and parent
+		   node are sharing, or the point where off-mesh link leaves.
+
+	\param triangle
+		   Index of node. Must be touched by current search.
+
+	\return Point
+			Middle point of portal, or end point for the root.
+	********************************************************************/
+	Point GetOrigin(int triangle) const;
+
+	/*!*******************************************************************
+	\brief
+		   Compute heuristic from given position to destination,
+		   scaled so cheap areas and links never make it overestimate.
+		   Remaining cost inside of start triangle is known exactly, so
+		   it is used there instead, and found path does not depend on
+		   heuristic.
+
+	\param position
+		   Point to compute. Origin of given node.
+
+	\param triangle
+		   Index of triangle including position.
+
+	\param edge
+		   Edge of triangle position is middle point of. Negative if it
+		   is other point, like end point or end of off-mesh link.
+
+	\return float
+			Return computed heuristic.
+	********************************************************************/
+	float ComputeHeuristic(const Point& position, int triangle, int edge) const;
+	/*!*******************************************************************
+	\brief
+		   Count node put into open list, as push or decrease-key by its
+		   status before.
+
+	\param status
+		   Status of the node before it was opened.
+	********************************************************************/
+	void CountOpen(SearchNode::Status status);
+
+	// Methods for path smoothing
+	/*!*******************************************************************
+	\brief
+		   Smooth path using simple stupid funnel algorithm.
+		   Works on portals stored by RestorePath, so only orientation
+		   tests are needed and there is no allocation. Corners are
+		   appended to smoothen path.
+
+	\param start
+		   Point where this part of path begins.
+	********************************************************************/
+	void FunnelAlgorithm(const Point& start);
+
+private:
+	using Context = BasicSearchContext<OpenList>;
+
+	const NavGraph* m_graph = nullptr; //!< Graph to search on. Owned by user of this query.
+	Context m_context; //!< Nodes and open list for A* pathfinding. Kept after search, so search can be resumed.
+
+	Status m_status = Status::NoPath; //!< Result of the last step.
+	bool m_isSearchValid = false; //!< True if nodes of current iteration form search tree rooted at current end point with current weight.
+	unsigned m_version = 0; //!< Version of graph when current search began. Graph cannot change while search runs, so result is found on it too.
+	bool m_isHeuristicOld = false; //!< True if start point moved after costs in open list were computed.
+	float m_radius = 0.f; //!< Radius of agent. If it is 0, agent is considered as a point.
+	float m_snapRadius = 0.f; //!< Distance start and end points can be moved onto the graph.
+	CostModel m_costModel; //!< Cost and passability of area types, from filter.
+	Heuristic m_heuristic; //!< Estimates cost to start point.
+	float m_weight = 1.f; //!< Weight for heuristic. If it is greater than 1, it A* does not guarantee optimal path, but searching speed would be faster. If it is 0, it is as same as dijkstra.
+	float m_heuristicScale = 1.f; //!< Current weight times the cheapest cost per distance. Computed when search or pass begins.
+	float m_costScale = 1.f; //!< The cheapest cost per distance, of areas and links. Computed when search begins.
+
+	float m_anytimeWeight = 0.f; //!< Weight for the first path of anytime search.
+	float m_weightStep = 0.f; //!< Decrease of weight for each pass of anytime search.
+	float m_currentWeight = 1.f; //!< Weight of current pass.
+	float m_boundWeight = 1.f; //!< Weight of the last finished pass.
+	bool m_isAnytime = false; //!< True if current search is anytime search.
+	bool m_isImproving = false; //!< True if a pass after the first one is not finished.
+	std::vector<int> m_closedNodes; //!< Nodes closed by current pass of anytime search.
+	std::vector<int> m_inconsistentNodes; //!< Closed nodes whose cost got lower during current pass. Opened by next pass.
+
+	std::vector<Point> m_path; //!< Container of origins of nodes of final path.
+	std::vector<int> m_pathTriangles; //!< Container of triangles of final path.
+	float m_pathCost = 0.f; //!< Cost of final path.
+	std::vector<Point> m_smoothPath; //!< Container of points on the smoothen path.
+	std::vector<int> m_smoothPathLinks; //!< Off-mesh link taken to arrive at each point of smoothen path, or -1.
+	std::vector<int> m_nodeLinks; //!< Off-mesh link * 2 + 1 if taken backward, for nodes reached by links.
+	std::vector<Point> m_portalLefts; //!< Left vertices of portals along the path. Reused for every path.
+	std::vector<Point> m_portalRights; //!< Right vertices of portals along the path. Reused for every path.
+
+	Point m_start; //!< Beginning point of path.
+	Point m_end; //!< Destination point of path.
+	Point m_requestedStart; //!< Start point given by user, before moved onto the graph.
+	Point m_requestedEnd; //!< End point given by user, before moved onto the graph.
+
+	int m_startTriangle = -1; //!< The triangle which start point is included.
+	int m_endTriangle = -1; //!< The triangle which end point is included.
+
+	SearchStats m_stats; //!< Work done by current query.
+	float m_startLocateMicroseconds = 0.f; //!< Time taken to find triangle of current start point.
+	float m_endLocateMicroseconds = 0.f; //!< Time taken to find triangle of current end point.
+};
+
+using PathQuery = BasicPathQuery<OctileHeuristic, FilterCost, BinaryHeap>; //!< Query used by the demo, services and crowds.
+
+#include "PathQuery.hpp"
+
+#endif // !PATHQUERY_H
\ No newline at end of file
@@ -0,0 +1,811 @@
+/*!*******************************************************************
+\headerfile   PathQuery.hpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+
+#include "PathQuery.h"
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::Initialize(const NavGraph& graph)
+{
+	m_graph = &graph;
+
+	// Initialize each node for each triangle.
+	m_context.Initialize(graph.GetTriangleCount());
+	m_nodeLinks.assign(graph.GetTriangleCount(), -1);
+
+	// Initialize variables for pathfinding newly.
+	m_start = m_requestedStart;
+	m_end = m_requestedEnd;
+	{
+		StatsTimer timer(m_startLocateMicroseconds = 0.f);
+		m_startTriangle = GetTriangle(m_start);
+	}
+	{
+		StatsTimer timer(m_endLocateMicroseconds = 0.f);
+		m_endTriangle = GetTriangle(m_end);
+	}
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetStart(const Point& start)
+{
+	// Find start node newly.
+	m_requestedStart = m_start = start;
+	{
+		StatsTimer timer(m_startLocateMicroseconds = 0.f);
+		m_startTriangle = GetTriangle(m_start);
+	}
+
+	m_isHeuristicOld = true;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetEnd(const Point& end)
+{
+	// Find end node newly.
+	m_requestedEnd = m_end = end;
+	{
+		StatsTimer timer(m_endLocateMicroseconds = 0.f);
+		m_endTriangle = GetTriangle(m_end);
+	}
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetWeight(float weight)
+{
+	m_weight = weight;
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetRadius(float radius)
+{
+	m_radius = radius;
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetFilter(const QueryFilter& filter)
+{
+	m_costModel.SetFilter(filter);
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetHeuristic(const Heuristic& heuristic)
+{
+	m_heuristic = heuristic;
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetAnytime(float initialWeight, float weightStep)
+{
+	m_anytimeWeight = initialWeight;
+	m_weightStep = weightStep;
+
+	m_isSearchValid = false;
+	m_status = Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::SetSnapRadius(float snapRadius)
+{
+	m_snapRadius = snapRadius;
+
+	// Both points may be moved differently.
+	SetStart(m_requestedStart);
+	SetEnd(m_requestedEnd);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+typename BasicPathQuery<Heuristic, CostModel, OpenList>::Status BasicPathQuery<Heuristic, CostModel, OpenList>::Step(int maxNodes, float maxMicroseconds)
+{
+	NullTrace trace;
+	return Step(trace, maxNodes, maxMicroseconds);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+typename BasicPathQuery<Heuristic, CostModel, OpenList>::Status BasicPathQuery<Heuristic, CostModel, OpenList>::Improve(int maxNodes, float maxMicroseconds)
+{
+	using Clock = std::chrono::steady_clock;
+	const auto begin = Clock::now();
+	StatsTimer timer(m_stats.m_searchMicroseconds);
+
+	NullTrace trace;
+	int expanded = 0;
+
+	// Search tree is stale after graph changed. Next step searches again.
+	while (m_status == Status::Found && CanImprove() && m_version == m_graph->GetVersion())
+	{
+		if (!m_isImproving)
+			BeginPass();
+
+		float remaining = -1.f;
+		if (maxMicroseconds >= 0.f)
+		{
+			const std::chrono::duration<float, std::micro> elapsed = Clock::now() - begin;
+			remaining = std::max(maxMicroseconds - elapsed.count(), 0.f);
+		}
+
+		// Unfinished pass keeps previous path, and continues on the next call.
+		const Status status = Search(trace, maxNodes, remaining, expanded);
+		if (status == Status::Pending)
+			break;
+
+		m_status = status;
+	}
+
+	return m_status;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+float BasicPathQuery<Heuristic, CostModel, OpenList>::GetSuboptimalityBound() const
+{
+	return std::max(m_boundWeight, 1.f);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+bool BasicPathQuery<Heuristic, CostModel, OpenList>::CanImprove() const
+{
+	return m_isAnytime && (m_isImproving || m_currentWeight > m_weight);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+typename BasicPathQuery<Heuristic, CostModel, OpenList>::Status BasicPathQuery<Heuristic, CostModel, OpenList>::GetStatus() const
+{
+	return m_status;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+unsigned BasicPathQuery<Heuristic, CostModel, OpenList>::GetGraphVersion() const
+{
+	return m_version;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const Point& BasicPathQuery<Heuristic, CostModel, OpenList>::GetStart() const
+{
+	return m_start;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const Point& BasicPathQuery<Heuristic, CostModel, OpenList>::GetEnd() const
+{
+	return m_end;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const std::vector<Point>& BasicPathQuery<Heuristic, CostModel, OpenList>::GetPath() const
+{
+	return m_path;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const std::vector<int>& BasicPathQuery<Heuristic, CostModel, OpenList>::GetPathTriangles() const
+{
+	return m_pathTriangles;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+float BasicPathQuery<Heuristic, CostModel, OpenList>::GetPathCost() const
+{
+	return m_pathCost;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const std::vector<Point>& BasicPathQuery<Heuristic, CostModel, OpenList>::GetSmoothPath() const
+{
+	return m_smoothPath;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const std::vector<int>& BasicPathQuery<Heuristic, CostModel, OpenList>::GetSmoothPathLinks() const
+{
+	return m_smoothPathLinks;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+const SearchStats& BasicPathQuery<Heuristic, CostModel, OpenList>::GetStats() const
+{
+	return m_stats;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+bool BasicPathQuery<Heuristic, CostModel, OpenList>::BeginSearch()
+{
+	// Clear all contianers and reset variables.
+	// Version is kept even if search fails at once, so same graph does not cause another search.
+	m_isSearchValid = false;
+	m_version = m_graph->GetVersion();
+	m_isHeuristicOld = false;
+	m_path.clear();
+	m_pathTriangles.clear();
+	m_pathCost = 0.f;
+	m_smoothPath.clear();
+	m_smoothPathLinks.clear();
+
+	// New query. Both points were located for it.
+	m_stats = SearchStats();
+	m_stats.m_locateMicroseconds = m_startLocateMicroseconds + m_endLocateMicroseconds;
+
+	// Special case. One of vertices is not inside of polygon.
+	if (m_startTriangle < 0 || m_endTriangle < 0)
+		return false;
+
+	// Special case. Points are in different components, so search would visit every reachable node for nothing.
+	if (!m_graph->AreConnected(m_startTriangle, m_endTriangle))
+		return false;
+
+	// Special case. One of points is in excluded area or blocked triangle.
+	if (!m_costModel.IsIncluded(m_graph->GetArea(m_startTriangle)) || !m_costModel.IsIncluded(m_graph->GetArea(m_endTriangle)))
+		return false;
+
+	if (m_graph->IsBlocked(m_startTriangle) || m_graph->IsBlocked(m_endTriangle))
+		return false;
+
+	m_heuristic.SetGoal(m_start, m_startTriangle);
+
+	// Cheapest area or link bounds cost per distance, so heuristic stays admissible.
+	m_costScale = m_costModel.GetMinCost();
+	if (m_costModel.AreOffMeshLinksIncluded())
+		m_costScale = std::min(m_costScale, m_graph->GetMinLinkCostRatio());
+
+	// Anytime search begins with its own weight, and lowers it after each path.
+	m_isAnytime = m_anytimeWeight > m_weight;
+	m_isImproving = false;
+	m_currentWeight = m_isAnytime ? m_anytimeWeight : m_weight;
+	m_heuristicScale = m_currentWeight * m_costScale;
+	m_closedNodes.clear();
+	m_inconsistentNodes.clear();
+
+	// Set up first point. Start from end point, so easily can restore path.
+	m_context.Clear();
+	m_context.Open(m_endTriangle, -1, Context::NoPortal, 0.f, ComputeHeuristic(m_end, m_endTriangle, -1));
+	CountOpen(SearchNode::Status::Default);
+	m_isSearchValid = true;
+
+	return true;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+typename BasicPathQuery<Heuristic, CostModel, OpenList>::Status BasicPathQuery<Heuristic, CostModel, OpenList>::ResumeSearch()
+{
+	m_isHeuristicOld = false;
+	m_path.clear();
+	m_pathTriangles.clear();
+	m_pathCost = 0.f;
+	m_smoothPath.clear();
+	m_smoothPathLinks.clear();
+
+	// New query on old search tree. Only start point was located for it.
+	m_stats = SearchStats();
+	m_stats.m_locateMicroseconds = m_startLocateMicroseconds;
+
+	// Special case. Start point is not inside of polygon or cut off from end point. Keep search tree for next start point.
+	if (m_startTriangle < 0 || !m_graph->AreConnected(m_startTriangle, m_endTriangle) || !m_costModel.IsIncluded(m_graph->GetArea(m_startTriangle)) || m_graph->IsBlocked(m_startTriangle))
+		return Status::NoPath;
+
+	// Start node has been closed already, so its parents are the path.
+	if (m_context.GetStatus(m_startTriangle) == SearchNode::Status::Closed)
+	{
+		RestorePath();
+		return Status::Found;
+	}
+
+	// Heuristic is computed toward start point, so costs in open list are old.
+	m_heuristic.SetGoal(m_start, m_startTriangle);
+	m_context.Rebuild([this](int triangle) {
+		const SearchNode& node = m_context.GetNode(triangle);
+		const int edge = node.m_portal < 3 ? static_cast<int>(node.m_portal) : -1;
+		return node.m_given + ComputeHeuristic(GetOrigin(triangle), triangle, edge);
+	});
+
+	return Status::Pending;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+bool BasicPathQuery<Heuristic, CostModel, OpenList>::IsWideEnough(int triangle, int entry, int exit) const
+{
+	const float diameter = m_radius * 2.f;
+
+	// Agent stops inside of this triangle, so only the edge matters.
+	if (exit < 0)
+		return DistanceBetween(m_graph->GetVertex(triangle, entry), m_graph->GetVertex(triangle, (entry + 1) % 3)) >= diameter;
+
+	// Going back to parent.
+	if (entry == exit)
+		return false;
+
+	// Clearance is stored on the third edge of the triangle.
+	return m_graph->GetClearance(triangle, 3 - entry - exit) >= diameter;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+bool BasicPathQuery<Heuristic, CostModel, OpenList>::IsImprovement(const SearchNode& node, SearchNode::Status status, float given, float cost) const
+{
+	// Open list only moves nodes toward the front, so cost of open node must decrease too.
+	if (m_isAnytime)
+		return given < node.m_given && (status != SearchNode::Status::Open || cost < node.m_cost);
+
+	return cost < node.m_cost;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::BeginPass()
+{
+	m_currentWeight = m_weightStep > 0.f ? std::max(m_currentWeight - m_weightStep, m_weight) : m_weight;
+	m_heuristicScale = m_currentWeight * m_costScale;
+	m_isImproving = true;
+
+	// Every node can be closed again in this pass.
+	for (int node : m_closedNodes)
+		m_context.MarkVisited(node);
+
+	m_closedNodes.clear();
+
+	// Nodes improved after closed are expanded again. Same node may be in the list several times.
+	for (int node : m_inconsistentNodes)
+	{
+		if (m_context.GetStatus(node) == SearchNode::Status::Open) continue;
+
+		const SearchNode& searchNode = m_context.GetNode(node);
+		m_context.Open(node, searchNode.m_parent, static_cast<int>(searchNode.m_portal), searchNode.m_given, searchNode.m_cost);
+		CountOpen(SearchNode::Status::Visited);
+	}
+
+	m_inconsistentNodes.clear();
+
+	// Costs in open list were computed with previous weight.
+	m_context.Rebuild([this](int triangle) {
+		const SearchNode& node = m_context.GetNode(triangle);
+		const int edge = node.m_portal < 3 ? static_cast<int>(node.m_portal) : -1;
+		return node.m_given + ComputeHeuristic(GetOrigin(triangle), triangle, edge);
+	});
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::RestorePath()
+{
+	StatsTimer timer(m_stats.m_restoreMicroseconds, &m_stats.m_searchMicroseconds);
+
+	// Path of previous pass is replaced.
+	m_path.clear();
+	m_pathTriangles.clear();
+	m_smoothPath.clear();
+	m_smoothPathLinks.clear();
+	m_boundWeight = m_currentWeight;
+	m_isImproving = false;
+
+	// Search stops at origin of start node, so the walk from start point is added.
+	const float startCost = m_costModel.GetCost(m_graph->GetArea(m_startTriangle));
+	m_pathCost = m_context.GetNode(m_startTriangle).m_given + DistanceBetween(m_start, GetOrigin(m_startTriangle)) * startCost;
+
+	m_portalLefts.clear();
+	m_portalRights.clear();
+
+	Point start = m_start;
+
+	// Walk from start node to end node. Portal to the next node is recorded on each node.
+	for (int triangle = m_startTriangle; triangle >= 0; triangle = m_context.GetNode(triangle).m_parent)
+	{
+		m_path.push_back(GetOrigin(triangle));
+		m_pathTriangles.push_back(triangle);
+
+		const SearchNode& node = m_context.GetNode(triangle);
+		if (node.m_parent < 0) break;
+
+		// Off-mesh link splits path. Walk to where it leaves, then continue from where it arrives.
+		if (node.m_portal == Context::LinkPortal)
+		{
+			const int link = m_nodeLinks[triangle] / 2;
+			const bool isReversed = m_nodeLinks[triangle] % 2 != 0;
+			const auto& offMeshLink = m_graph->GetOffMeshLink(link);
+
+			const Point& departure = isReversed ? offMeshLink.m_end : offMeshLink.m_start;
+			const Point& arrival = isReversed ? offMeshLink.m_start : offMeshLink.m_end;
+
+			m_portalLefts.push_back(departure);
+			m_portalRights.push_back(departure);
+			FunnelAlgorithm(start);
+
+			if (m_smoothPath.empty() || m_smoothPath.back() != departure)
+				m_smoothPath.push_back(departure);
+
+			m_smoothPathLinks.resize(m_smoothPath.size(), -1);
+			m_smoothPath.push_back(arrival);
+			m_smoothPathLinks.push_back(link);
+
+			m_portalLefts.clear();
+			m_portalRights.clear();
+			start = arrival;
+			continue;
+		}
+
+		Point left, right;
+		m_graph->GetPortal(triangle, static_cast<int>(node.m_portal), m_radius, left, right);
+
+		m_portalLefts.push_back(left);
+		m_portalRights.push_back(right);
+	}
+
+	// Last portal of both sides is destination point.
+	m_portalLefts.push_back(m_end);
+	m_portalRights.push_back(m_end);
+
+	FunnelAlgorithm(start);
+	m_smoothPathLinks.resize(m_smoothPath.size(), -1);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+int BasicPathQuery<Heuristic, CostModel, OpenList>::GetTriangle(Point& position) const
+{
+	if (m_graph == nullptr)
+		return -1;
+
+	return m_graph->FindNearestTriangle(position, m_snapRadius);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+Point BasicPathQuery<Heuristic, CostModel, OpenList>::GetOrigin(int triangle) const
+{
+	const SearchNode& node = m_context.GetNode(triangle);
+
+	// Root of the search tree starts from end point.
+	if (node.m_parent < 0)
+		return m_end;
+
+	// Off-mesh link leaves from its point, not from an edge.
+	if (node.m_portal == Context::LinkPortal)
+	{
+		const auto& offMeshLink = m_graph->GetOffMeshLink(m_nodeLinks[triangle] / 2);
+		return m_nodeLinks[triangle] % 2 != 0 ? offMeshLink.m_end : offMeshLink.m_start;
+	}
+
+	return m_graph->GetMidpoint(triangle, node.m_portal);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+float BasicPathQuery<Heuristic, CostModel, OpenList>::ComputeHeuristic(const Point& position, int triangle, int edge) const
+{
+	// Agent walks straight to start point inside of start triangle.
+	if (triangle == m_startTriangle)
+		return DistanceBetween(position, m_start) * m_costModel.GetCost(m_graph->GetArea(m_startTriangle));
+
+	// Cheapest area or link could be cheaper than 1, so distance is scaled by it to stay admissible.
+	return m_heuristic.Estimate(position, triangle, edge) * m_heuristicScale;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::CountOpen(SearchNode::Status status)
+{
+	if (!SearchStats::IsEnabled) return;
+
+	if (status == SearchNode::Status::Open)
+		++m_stats.m_decreaseKeys;
+	else
+		++m_stats.m_pushes;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+void BasicPathQuery<Heuristic, CostModel, OpenList>::FunnelAlgorithm(const Point& start)
+{
+	StatsTimer timer(m_stats.m_funnelMicroseconds, &m_stats.m_restoreMicroseconds);
+
+	// If there are less than 2 nodes, it means path is a single straight line already.
+	const int size = static_cast<int>(m_portalLefts.size());
+	if (SearchStats::IsEnabled)
+		m_stats.m_portals += size;
+
+	if (size < 2) return;
+
+	auto& left_vertices = m_portalLefts;
+	auto& right_vertices = m_portalRights;
+
+	// Variables for loop
+	int leftIndex = 0;
+	int rightIndex = 0;
+
+	// Store as pointer, so it is cheaper and easy to compare.
+	const Point* corner = &start;
+	const Point* portalLeft = &left_vertices[leftIndex];
+	const Point* portalRight = &right_vertices[rightIndex];
+
+	for (int i = 1; i < size; ++i)
+	{
+		if (SearchStats::IsEnabled)
+			++m_stats.m_funnelIterations;
+
+		auto& left = left_vertices[i];
+		auto& right = right_vertices[i];
+
+		// Update right vertex of edge
+		if (right != *portalRight)
+		{
+			// If new vertex can tighten the funnel,
+			if (TriArea(*corner, *portalRight, right) <= 0.f)
+			{
+				// portalRight just needs to be updated OR new vertex does not go over opposite side
+				if (corner == portalRight || TriArea(*corner, *portalLeft, right) > 0.f)
+				{
+					portalRight = &right; // Tighten the funnel.
+					rightIndex = i;
+				}
+				else // Right over left.
+				{
+					// Left becomes new corner and added to path.
+					corner = portalLeft;
+					m_smoothPath.push_back(*corner);
+
+					// Start from new corner
+					i = leftIndex;
+
+					// Set new left and right of portal
+					++leftIndex;
+					rightIndex = leftIndex;
+
+					if (leftIndex >= size) return;
+
+					portalLeft = &left_vertices[leftIndex];
+					portalRight = &right_vertices[rightIndex];
+
+					continue; // Not update left this time
+				}
+			}
+		}
+
+		// Update left vertex
+		if (left != *portalLeft)
+		{
+			// If new vertex can tighten the funnel,
+			if (TriArea(*corner, *portalLeft, left) >= 0.f)
+			{
+				// portalLeft just needs to be updated OR new vertex does not go over opposite side
+				if (corner == portalLeft || TriArea(*corner, *portalRight, left) < 0.f)
+				{
+					portalLeft = &left; // Tighten the funnel.
+					leftIndex = i;
+				}
+				else // Left over right.
+				{
+					// Right becomes new corner and added to path.
+					corner = portalRight;
+					m_smoothPath.push_back(*corner);
+
+					// Start from new corner
+					i = rightIndex;
+
+					// Set new left and right of portal
+					++rightIndex;
+					leftIndex = rightIndex;
+
+					if (leftIndex >= size) return;
+
+					portalLeft = &left_vertices[leftIndex];
+					portalRight = &right_vertices[rightIndex];
+				}
+			}
+		}
+	}
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+template <class Trace>
+typename BasicPathQuery<Heuristic, CostModel, OpenList>::Status BasicPathQuery<Heuristic, CostModel, OpenList>::Step(Trace& trace, int maxNodes, float maxMicroseconds)
+{
+	// Result found on older graph may go through blocked triangles, or miss opened ones. Search again.
+	if (m_status != Status::Pending && m_graph && m_version != m_graph->GetVersion())
+	{
+		m_isSearchValid = false;
+		m_status = Status::Pending;
+	}
+
+	if (m_status != Status::Pending)
+		return m_status;
+
+	// Restoring path inside removes its own time from this.
+	StatsTimer timer(m_stats.m_searchMicroseconds);
+
+	// Start new search, or reuse previous one if only start point moved and graph did not change.
+	if (!m_isSearchValid || m_version != m_graph->GetVersion())
+	{
+		trace.Clear();
+
+		if (!BeginSearch())
+			return m_status = Status::NoPath;
+	}
+	else if (m_isHeuristicOld)
+	{
+		m_status = ResumeSearch();
+		if (m_status != Status::Pending)
+			return m_status;
+	}
+
+	int expanded = 0;
+	return m_status = Search(trace, maxNodes, maxMicroseconds, expanded);
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+template <class Trace>
+typename BasicPathQuery<Heuristic, CostModel, OpenList>::Status BasicPathQuery<Heuristic, CostModel, OpenList>::Search(Trace& trace, int maxNodes, float maxMicroseconds, int& expanded)
+{
+	using Clock = std::chrono::steady_clock;
+	const auto begin = Clock::now();
+
+	// During there nodes remain inside open list, keep looking for path.
+	while (!m_context.IsOpenListEmpty())
+	{
+		// Start node closed by previous pass of anytime search is final, once no open node is cheaper.
+		if (m_isAnytime && m_context.GetStatus(m_startTriangle) == SearchNode::Status::Visited &&
+			m_context.GetNode(m_startTriangle).m_given + ComputeHeuristic(GetOrigin(m_startTriangle), m_startTriangle, -1) <= m_context.GetMinCost())
+			break;
+
+		// Path found. Neighbors are expanded already, so search can be resumed from here.
+		if (ExpandNode(trace) == m_startTriangle)
+		{
+			RestorePath();
+			return Status::Found;
+		}
+
+		// Check budget. Search continues from here on the next step.
+		++expanded;
+		if (maxNodes >= 0 && expanded >= maxNodes)
+			return Status::Pending;
+
+		if (maxMicroseconds >= 0.f)
+		{
+			const std::chrono::duration<float, std::micro> elapsed = Clock::now() - begin;
+			if (elapsed.count() >= maxMicroseconds)
+				return Status::Pending;
+		}
+	}
+
+	// Nothing left can improve start node closed by previous pass.
+	if (m_context.GetStatus(m_startTriangle) == SearchNode::Status::Visited)
+	{
+		RestorePath();
+		return Status::Found;
+	}
+
+	// Every reachable node is closed, but could not reach start node.
+	return Status::NoPath;
+}
+
+template <class Heuristic, class CostModel, class OpenList>
+template <class Trace>
+int BasicPathQuery<Heuristic, CostModel, OpenList>::ExpandNode(Trace& trace)
+{
+	// Grab node has lowest cost.
+	const int triangle = m_context.Close();
+	const SearchNode& thisNode = m_context.GetNode(triangle);
+	const Point origin = GetOrigin(triangle);
+
+	if (m_isAnytime)
+		m_closedNodes.push_back(triangle);
+
+	if (SearchStats::IsEnabled)
+		++m_stats.m_expanded;
+
+	// Constant condition, so the branch disappears if tracing is disabled.
+	if (Trace::IsEnabled && thisNode.m_parent >= 0)
+		trace.Visit(origin, GetOrigin(thisNode.m_parent));
+
+	// Edge toward parent. Agent passes through this triangle from a neighbor to that edge. Off-mesh link leaves from inside, same as end point.
+	const int exit = thisNode.m_parent >= 0 && thisNode.m_portal != Context::LinkPortal ? static_cast<int>(thisNode.m_portal) : -1;
+
+	// Distance inside of this triangle costs as its area.
+	const float multiplier = m_costModel.GetCost(m_graph->GetArea(triangle));
+
+	// Look all neighbors of this triangle.
+	for (int i = 0; i < 3; ++i)
+	{
+		// Walls have area no filter includes, so this skips walls and excluded areas at once.
+		if (!m_costModel.IsIncluded(m_graph->GetNeighborArea(triangle, i))) continue;
+
+		const int neighbor = m_graph->GetNeighbor(triangle, i);
+		if (m_graph->IsBlocked(neighbor)) continue;
+		if (m_radius > 0.f && !IsWideEnough(triangle, i, exit)) continue;
+
+		// Anytime search still keeps improvement of closed node.
+		const auto status = m_context.GetStatus(neighbor);
+		if (status == SearchNode::Status::Closed && !m_isAnytime) continue;
+
+		// Middle point of edge which is sharing. Standard for pathfinding.
+		const Point& new_origin = m_graph->GetMidpoint(triangle, i);
+
+		// Given cost is distance between two points times cost of area + given cost of parent node.
+		const float new_given = thisNode.m_given + DistanceBetween(new_origin, origin) * multiplier;
+		const float new_cost = new_given + ComputeHeuristic(new_origin, neighbor, m_graph->GetTwin(triangle, i));
+
+		// If this node has never been visitid for current pathfinding, or new cost is lower than existing cost,
+		if (status == SearchNode::Status::Default || IsImprovement(m_context.GetNode(neighbor), status, new_given, new_cost))
+		{
+			// push or update the node. Closed one waits for next pass of anytime search.
+			if (status == SearchNode::Status::Closed)
+			{
+				m_context.Update(neighbor, triangle, m_graph->GetTwin(triangle, i), new_given, new_cost);
+				m_inconsistentNodes.push_back(neighbor);
+			}
+			else
+			{
+				m_context.Open(neighbor, triangle, m_graph->GetTwin(triangle, i), new_given, new_cost);
+				CountOpen(status);
+			}
+
+			trace.Consider(new_origin, origin);
+		}
+	}
+
+	// Off-mesh links are rare, so flag in hot data is checked before side table.
+	if (m_graph->HasLinks(triangle) && m_costModel.AreOffMeshLinksIncluded())
+	{
+		const int count = m_graph->GetLinkCount(triangle);
+		for (int i = 0; i < count; ++i)
+		{
+			const int link = m_graph->GetLink(triangle, i);
+			const auto& offMeshLink = m_graph->GetOffMeshLink(link);
+
+			// Search goes from end to start, so agent must arrive at this triangle by the link.
+			const bool isReversed = offMeshLink.m_endTriangle != triangle;
+			if (isReversed && !offMeshLink.m_isBidirectional) continue;
+
+			const int neighbor = isReversed ? offMeshLink.m_endTriangle : offMeshLink.m_startTriangle;
+			if (!m_costModel.IsIncluded(m_graph->GetArea(neighbor)) || m_graph->IsBlocked(neighbor)) continue;
+
+			const auto status = m_context.GetStatus(neighbor);
+			if (status == SearchNode::Status::Closed && !m_isAnytime) continue;
+
+			// Agent walks from where link arrives to origin of this node, after paying for the link.
+			const Point& departure = isReversed ? offMeshLink.m_end : offMeshLink.m_start;
+			const Point& arrival = isReversed ? offMeshLink.m_start : offMeshLink.m_end;
+
+			const float new_given = thisNode.m_given + DistanceBetween(arrival, origin) * multiplier + offMeshLink.m_cost;
+			const float new_cost = new_given + ComputeHeuristic(departure, neighbor, -1);
+
+			if (status == SearchNode::Status::Default || IsImprovement(m_context.GetNode(neighbor), status, new_given, new_cost))
+			{
+				if (status == SearchNode::Status::Closed)
+				{
+					m_context.Update(neighbor, triangle, Context::LinkPortal, new_given, new_cost);
+					m_inconsistentNodes.push_back(neighbor);
+				}
+				else
+				{
+					m_context.Open(neighbor, triangle, Context::LinkPortal, new_given, new_cost);
+					CountOpen(status);
+				}
+
+				m_nodeLinks[neighbor] = link * 2 + (isReversed ? 1 : 0);
+				trace.Consider(departure, origin);
+			}
+		}
+	}
+
+	// Open list is largest right after neighbors are pushed.
+	if (SearchStats::IsEnabled)
+		m_stats.m_maxOpenSize = std::max(m_stats.m_maxOpenSize, m_context.GetOpenCount());
+
+	return triangle;
+}
\ No newline at end of file
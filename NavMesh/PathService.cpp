@@ -0,0 +1,204 @@
+/*!*******************************************************************
+\file		  PathService.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include "PathService.h"
+
+PathService::PathService(const NavGraph& graph, int workerCount, float snapRadius)
+	: m_graph(graph), m_snapRadius(snapRadius)
+{
+	for (int i = 0; i < workerCount; ++i)
+		m_workers.push_back(std::thread(&PathService::WorkerLoop, this));
+}
+
+PathService::~PathService()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isStopping = true;
+	}
+
+	m_condition.notify_all();
+	for (auto& worker : m_workers)
+		worker.join();
+
+	// Nobody will search rest of requests, so do not let futures wait forever.
+	for (auto& request : m_queue)
+		request->m_promise.set_value(Result());
+}
+
+std::shared_future<PathService::Result> PathService::Submit(const Point& start, const Point& end, float weight, float radius, bool isTraced, Callback callback)
+{
+	const Key key(start.X, start.Y, end.X, end.Y, weight, radius, isTraced);
+
+	std::shared_future<Result> future;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		// Same request is pending. Wait for that one.
+		auto found = m_pending.find(key);
+		if (found != m_pending.end())
+		{
+			if (callback)
+				found->second->m_callbacks.push_back(std::move(callback));
+
+			return found->second->m_future;
+		}
+
+		// Make new request.
+		auto request = std::make_shared<Request>();
+		request->m_key = key;
+		request->m_future = request->m_promise.get_future().share();
+		if (callback)
+			request->m_callbacks.push_back(std::move(callback));
+
+		m_pending[key] = request;
+		m_queue.push_back(request);
+		future = request->m_future;
+	}
+
+	m_condition.notify_one();
+	return future;
+}
+
+void PathService::Poll()
+{
+	std::vector<std::pair<Callback, std::shared_future<Result>>> finished;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		finished.swap(m_finished);
+	}
+
+	// Call outside of lock, so callbacks can submit new requests.
+	for (auto& callback : finished)
+		callback.first(callback.second.get());
+}
+
+void PathService::UpdateGraph(const std::function<void()>& update)
+{
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_isUpdating = true;
+		m_idle.wait(lock, [this]() { return m_searchCount == 0; });
+	}
+
+	// No worker reads graph now. Lock is released, so submitting is not blocked by long update.
+	update();
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isUpdating = false;
+	}
+
+	m_condition.notify_all();
+}
+
+SearchStatsHistogram PathService::GetStats()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+void PathService::ClearStats()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_stats.Clear();
+}
+
+void PathService::WorkerLoop()
+{
+	PathQuery query;
+	query.SetSnapRadius(m_snapRadius);
+	query.Initialize(m_graph);
+	FullTrace trace;
+
+	// Remember last points, so search tree can be reused for same end point.
+	bool isFirst = true;
+	Point lastEnd;
+	float lastWeight = 1.f;
+	float lastRadius = 0.f;
+
+	while (true)
+	{
+		std::shared_ptr<Request> request;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return m_isStopping || (!m_isUpdating && !m_queue.empty()); });
+
+			if (m_isStopping)
+				return;
+
+			request = m_queue.front();
+			m_queue.pop_front();
+			++m_searchCount;
+		}
+
+		const Point start(std::get<0>(request->m_key), std::get<1>(request->m_key));
+		const Point end(std::get<2>(request->m_key), std::get<3>(request->m_key));
+		const float weight = std::get<4>(request->m_key);
+		const float radius = std::get<5>(request->m_key);
+		const bool isTraced = std::get<6>(request->m_key);
+
+		// Setting same end point again would throw away the search tree. Traced request needs the whole search.
+		if (isFirst || weight != lastWeight)
+			query.SetWeight(weight);
+		if (isFirst || radius != lastRadius)
+			query.SetRadius(radius);
+		if (isFirst || end != lastEnd || isTraced)
+			query.SetEnd(end);
+		query.SetStart(start);
+
+		isFirst = false;
+		lastEnd = end;
+		lastWeight = weight;
+		lastRadius = radius;
+
+		Result result;
+		result.m_status = isTraced ? query.Step(trace) : query.Step();
+		result.m_graphVersion = query.GetGraphVersion();
+
+		if (isTraced)
+			result.m_trace = trace;
+
+		// Points may have been moved onto the graph.
+		if (result.m_status == PathQuery::Status::Found)
+		{
+			const auto& corners = query.GetSmoothPath();
+
+			result.m_points.reserve(corners.size() + 2);
+			result.m_points.push_back(query.GetStart());
+			result.m_points.insert(result.m_points.end(), corners.begin(), corners.end());
+			result.m_points.push_back(query.GetEnd());
+
+			const auto& origins = query.GetPath();
+
+			result.m_path.reserve(origins.size() + 1);
+			result.m_path.push_back(query.GetStart());
+			result.m_path.insert(result.m_path.end(), origins.begin(), origins.end());
+		}
+
+		Finish(request, std::move(result), query.GetStats());
+	}
+}
+
+void PathService::Finish(const std::shared_ptr<Request>& request, Result&& result, const SearchStats& stats)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (SearchStats::IsEnabled)
+		m_stats.Add(stats);
+
+	// From now on, same request will be searched newly.
+	m_pending.erase(request->m_key);
+
+	request->m_promise.set_value(std::move(result));
+
+	for (auto& callback : request->m_callbacks)
+		m_finished.push_back(std::make_pair(std::move(callback), request->m_future));
+
+	// Graph update waits for every running search.
+	if (--m_searchCount == 0 && m_isUpdating)
+		m_idle.notify_one();
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+/*!*******************************************************************
+\headerfile   PathService.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for PathService class which finds paths
+			  on worker threads.
+********************************************************************/
+#ifndef PATHSERVICE_H
+#define PATHSERVICE_H
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <tuple>
+#include <memory>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "PathQuery.h"
+#include "SearchTrace.h"
+#include "SearchStats.h"
+
+/*!*******************************************************************
+\class PathService
+\brief
+	   Queue of path requests drained by a fixed set of worker
+	   threads. Each worker owns its own path query, so requests
+	   never block the thread submitting them.
+********************************************************************/
+class PathService
+{
+public:
+	/*!*******************************************************************
+	\struct Result
+	\brief
+		   Found path of one request.
+	********************************************************************/
+	struct Result
+	{
+		PathQuery::Status m_status = PathQuery::Status::NoPath; //!< Found or NoPath.
+		std::vector<Point> m_points; //!< Smoothen path including start point and end point. Empty if there is no path.
+		std::vector<Point> m_path; //!< Origins of nodes of path before smoothing, including start point and end point. Empty if there is no path.
+		FullTrace m_trace; //!< All nodes touched by the search. Empty unless request asked for it.
+		unsigned m_graphVersion = 0; //!< Version of graph the path was found on. Path is stale if it differs from NavGraph::GetVersion.
+	};
+
+	using Callback = std::function<void(const Result&)>;
+
+	/*!*******************************************************************
+	\brief
+		   Constructor that starts worker threads.
+
+	\param graph
+		   Graph to search on. Must not be moved until this service is
+		   destroyed, and must be changed only inside UpdateGraph.
+
+	\param workerCount
+		   The number of worker threads.
+
+	\param snapRadius
+		   Distance start and end points can be moved onto the graph.
+		   Result has moved points.
+	********************************************************************/
+	PathService(const NavGraph& graph, int workerCount, float snapRadius = 0.f);
+	/*!*******************************************************************
+	\brief
+		   Destructor that stops and joins all workers.
+		   Requests not started yet are finished with NoPath.
+	********************************************************************/
+	~PathService();
+
+	PathService(const PathService&) = delete;
+	PathService& operator=(const PathService&) = delete;
+
+	/*!*******************************************************************
+	\brief
+		   Push new path request into the queue. If same request is
+		   pending already, share the result of that one.
+
+	\param start
+		   Beginning point of path.
+
+	\param end
+		   Destination point of path.
+
+	\param weight
+		   Weight for heuristic.
+
+	\param radius
+		   Radius of agent.
+
+	\param isTraced
+		   True to record all nodes touched by the search into result.
+		   Searched from the beginning then, so trace is complete.
+
+	\param callback
+		   Called with the result inside Poll, on the thread calling
+		   Poll. Can be empty.
+
+	\return std::shared_future<Result>
+			Future that will have the result.
+	********************************************************************/
+	std::shared_future<Result> Submit(const Point& start, const Point& end, float weight = 1.f, float radius = 0.f, bool isTraced = false, Callback callback = Callback());
+
+	/*!*******************************************************************
+	\brief
+		   Call callbacks of all requests finished since last call.
+		   Supposed to be called every frame by the submitting thread.
+	********************************************************************/
+	void Poll();
+	/*!*******************************************************************
+	\brief
+		   Change the graph while no worker reads it. Workers finish
+		   searches they are running, then wait until given function
+		   returns. Requests still queued are searched on the changed
+		   graph, and results found before keep the old version.
+
+	\param update
+		   Function changing the graph, like blocking triangles. Graph
+		   increases its version by itself.
+	********************************************************************/
+	void UpdateGraph(const std::function<void()>& update);
+	/*!*******************************************************************
+	\brief
+		   Getter method for statistics of all requests searched so far.
+
+	\return SearchStatsHistogram
+			Copy of histograms, taken under lock.
+	********************************************************************/
+	SearchStatsHistogram GetStats();
+	/*!*******************************************************************
+	\brief
+		   Remove statistics of requests searched so far.
+	********************************************************************/
+	void ClearStats();
+
+private:
+	using Key = std::tuple<float, float, float, float, float, float, bool>;
+
+	/*!*******************************************************************
+	\struct Request
+	\brief
+		   Path request waiting in the queue or being searched.
+	********************************************************************/
+	struct Request
+	{
+		Key m_key; //!< Start point, end point, weight, radius and trace flag of this request.
+		std::promise<Result> m_promise; //!< Promise to set result.
+		std::shared_future<Result> m_future; //!< Future shared by all coalesced submissions.
+		std::vector<Callback> m_callbacks; //!< Callbacks of all coalesced submissions.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Loop of each worker thread. Takes request from the queue and
+		   finds path until service stops.
+	********************************************************************/
+	void WorkerLoop();
+	/*!*******************************************************************
+	\brief
+		   Set result of given request and move its callbacks to be
+		   called on the next poll.
+
+	\param request
+		   Request that has been searched.
+
+	\param result
+		   Result of the request.
+
+	\param stats
+		   Statistics of the search for the request.
+	********************************************************************/
+	void Finish(const std::shared_ptr<Request>& request, Result&& result, const SearchStats& stats);
+
+private:
+	const NavGraph& m_graph; //!< Graph shared by all workers. Only read.
+	float m_snapRadius; //!< Distance start and end points can be moved onto the graph.
+
+	std::mutex m_mutex; //!< Guards all containers below.
+	std::condition_variable m_condition; //!< Wakes up workers when request is pushed, graph update ends or service stops.
+	std::condition_variable m_idle; //!< Wakes up graph update when the last running search finishes.
+	bool m_isStopping = false; //!< True if workers have to stop.
+	bool m_isUpdating = false; //!< True while graph is changed. Workers do not take new request.
+	int m_searchCount = 0; //!< The number of searches running on workers.
+
+	std::deque<std::shared_ptr<Request>> m_queue; //!< Requests waiting for worker.
+	std::map<Key, std::shared_ptr<Request>> m_pending; //!< Requests queued or being searched. Used to coalesce same requests.
+	std::vector<std::pair<Callback, std::shared_future<Result>>> m_finished; //!< Callbacks waiting for next poll.
+	SearchStatsHistogram m_stats; //!< Statistics of all searched requests.
+
+	std::vector<std::thread> m_workers; //!< Worker threads.
+};
+
+#endif // !PATHSERVICE_H
\ No newline at end of file
@@ -79,12 +79,11 @@ float ScalarTripleProduct(const Vector& v1, const Vector& v2)
 
 float GetAngleBetween(const Vector& v1, const Vector& v2)
 {
-	// acos gives smaller angle between two vectors.
-	float angle = std::acosf(DotProduct(v1, v2)) / PI * 180.f;
-
-	// Determine the direction of angle depends on the sign of vector that is computed by cross product of two vectors.
-	if (ScalarTripleProduct(v1, v2) > 0)
-		angle = 360.f - angle;
+	// Angle from both sine and cosine. acos alone loses precision near 0 and 180 degrees, and gives NaN once rounding passes 1.
+	// Direction of angle depends on the sign of vector that is computed by cross product of two vectors.
+	float angle = std::atan2(-ScalarTripleProduct(v1, v2), (v1.X * v2.X) + (v1.Y * v2.Y)) / PI * 180.f;
+	if (angle < 0.f)
+		angle += 360.f;
 
 	return angle;
 }
@@ -97,6 +96,28 @@ float DistanceBetween(const Point& p1, const Point& p2)
 	return std::sqrtf(dx * dx + dy * dy);
 }
 
+Point ClosestPointOnSegment(const Point& p, const Point& start, const Point& end)
+{
+	const Vector segment = end - start;
+	const float lengthSq = segment.X * segment.X + segment.Y * segment.Y;
+
+	// Degenerated segment.
+	if (lengthSq == 0.f)
+		return start;
+
+	// Project point onto the segment, and clamp inside of it.
+	const Vector v = p - start;
+	float t = (v.X * segment.X + v.Y * segment.Y) / lengthSq;
+	t = std::fmax(0.f, std::fmin(1.f, t));
+
+	return start + segment * t;
+}
+
+float DistanceToSegment(const Point& p, const Point& start, const Point& end)
+{
+	return DistanceBetween(p, ClosestPointOnSegment(p, start, end));
+}
+
 float TriArea(const Point& p, const Point& p1, const Point& p2)
 {
 	// Cross product = area of parallelogram
@@ -209,6 +209,42 @@ float GetAngleBetween(const Vector& v1, const Vector& v2);
 		The distance between two points.
 ********************************************************************/
 float DistanceBetween(const Point& p1, const Point& p2);
+/*!*******************************************************************
+\brief
+		Helper method to find the closest point on given segment to
+		given point.
+
+\param p
+	   Point to compute.
+
+\param start
+	   One of vertices of the segment.
+
+\param end
+	   One of vertices of the segment.
+
+\return Point
+		The closest point on the segment.
+********************************************************************/
+Point ClosestPointOnSegment(const Point& p, const Point& start, const Point& end);
+/*!*******************************************************************
+\brief
+		Helper method to compute distance between given point and
+		the closest point on given segment.
+
+\param p
+	   Point to compute distance.
+
+\param start
+	   One of vertices of the segment.
+
+\param end
+	   One of vertices of the segment.
+
+\return float
+		The distance between point and segment.
+********************************************************************/
+float DistanceToSegment(const Point& p, const Point& start, const Point& end);
 
 /*!*******************************************************************
 \brief
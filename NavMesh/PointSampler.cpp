@@ -0,0 +1,251 @@
+/*!*******************************************************************
+\file		  PointSampler.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <cmath>
+#include <algorithm>
+
+#include "PointSampler.h"
+
+namespace
+{
+	const int MaxCircleTries = 64; //!< The number of samples tried before giving up on circle.
+}
+
+void PointSampler::Initialize(const NavGraph& graph, unsigned seed)
+{
+	m_graph = &graph;
+	m_random.seed(seed);
+
+	const int size = graph.GetTriangleCount();
+	const int regionCount = graph.GetComponentCount();
+
+	m_marks.assign(size, 0);
+	m_iteration = 0;
+
+	// Sort triangles by connected component, so triangles of a region are contiguous.
+	std::vector<int> offsets(regionCount + 1, 0);
+	for (int i = 0; i < size; ++i)
+		++offsets[graph.GetComponent(i) + 1];
+
+	for (int i = 0; i < regionCount; ++i)
+		offsets[i + 1] += offsets[i];
+
+	m_regions.resize(regionCount);
+	for (int i = 0; i < regionCount; ++i)
+		m_regions[i] = Region{ offsets[i], offsets[i + 1] };
+
+	m_triangles.resize(size);
+	for (int i = 0; i < size; ++i)
+		m_triangles[offsets[graph.GetComponent(i)]++] = i;
+
+	// Table of each region chooses triangle by area.
+	std::vector<float> weights(size);
+	for (int i = 0; i < size; ++i)
+		weights[i] = ComputeArea(m_triangles[i]);
+
+	std::vector<float> regionWeights(regionCount, 0.f);
+
+	for (int i = 0; i < regionCount; ++i)
+	{
+		const Region& region = m_regions[i];
+		for (int j = region.m_begin; j < region.m_end; ++j)
+			regionWeights[i] += weights[j];
+	}
+
+	m_probabilities.resize(size);
+	m_aliases.resize(size);
+	for (const Region& region : m_regions)
+		BuildAliasTable(weights, region.m_begin, region.m_end, m_probabilities, m_aliases);
+
+	// One more table chooses region by its area.
+	m_regionProbabilities.resize(regionCount);
+	m_regionAliases.resize(regionCount);
+	BuildAliasTable(regionWeights, 0, regionCount, m_regionProbabilities, m_regionAliases);
+}
+
+int PointSampler::Sample(Point& point)
+{
+	if (m_regions.empty())
+		return -1;
+
+	const int region = SampleAliasTable(0, static_cast<int>(m_regions.size()), m_regionProbabilities, m_regionAliases);
+	const int triangle = m_triangles[SampleAliasTable(m_regions[region].m_begin, m_regions[region].m_end, m_probabilities, m_aliases)];
+
+	point = SampleTriangle(triangle);
+	return triangle;
+}
+
+int PointSampler::SampleInRegion(int triangle, Point& point)
+{
+	const Region& region = m_regions[m_graph->GetComponent(triangle)];
+	const int picked = m_triangles[SampleAliasTable(region.m_begin, region.m_end, m_probabilities, m_aliases)];
+
+	point = SampleTriangle(picked);
+	return picked;
+}
+
+int PointSampler::SampleInCircle(const Point& center, float radius, Point& point)
+{
+	const int first = m_graph ? m_graph->FindTriangle(center) : -1;
+	if (first < 0 || radius < 0.f)
+		return -1;
+
+	// Reset marks only when counter wraps.
+	if (++m_iteration == 0)
+	{
+		std::fill(m_marks.begin(), m_marks.end(), 0);
+		m_iteration = 1;
+	}
+
+	// Triangles reachable from center without leaving circle. Neighbor is entered through shared edge inside of circle.
+	m_candidates.clear();
+	m_cumulativeAreas.clear();
+
+	m_candidates.push_back(first);
+	m_marks[first] = m_iteration;
+
+	float totalArea = 0.f;
+	for (size_t next = 0; next < m_candidates.size(); ++next)
+	{
+		const int triangle = m_candidates[next];
+
+		totalArea += ComputeArea(triangle);
+		m_cumulativeAreas.push_back(totalArea);
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const int neighbor = m_graph->GetNeighbor(triangle, i);
+			if (neighbor < 0 || m_marks[neighbor] == m_iteration) continue;
+
+			if (DistanceToSegment(center, m_graph->GetVertex(triangle, i), m_graph->GetVertex(triangle, (i + 1) % 3)) > radius) continue;
+
+			m_marks[neighbor] = m_iteration;
+			m_candidates.push_back(neighbor);
+		}
+	}
+
+	// Reject samples outside of both, from whichever is smaller. Fewer samples are rejected then.
+	const float pi = 3.14159265f;
+	const bool fromTriangles = totalArea <= pi * radius * radius;
+
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+	for (int i = 0; i < MaxCircleTries; ++i)
+	{
+		if (fromTriangles)
+		{
+			const float area = unit(m_random) * totalArea;
+			const size_t index = std::min(static_cast<size_t>(std::upper_bound(m_cumulativeAreas.begin(), m_cumulativeAreas.end(), area) - m_cumulativeAreas.begin()), m_candidates.size() - 1);
+
+			const Point sample = SampleTriangle(m_candidates[index]);
+			if (DistanceBetween(sample, center) <= radius)
+			{
+				point = sample;
+				return m_candidates[index];
+			}
+		}
+		else
+		{
+			// Square root of distance, so sample is uniform by area.
+			const float angle = unit(m_random) * 2.f * pi;
+			const float distance = std::sqrt(unit(m_random)) * radius;
+			const Point sample = center + Point(std::cos(angle), std::sin(angle)) * distance;
+
+			for (int triangle : m_candidates)
+			{
+				if (m_graph->IsPointInside(triangle, sample))
+				{
+					point = sample;
+					return triangle;
+				}
+			}
+		}
+	}
+
+	return -1;
+}
+
+void PointSampler::BuildAliasTable(std::vector<float>& weights, int begin, int end, std::vector<float>& probabilities, std::vector<int>& aliases)
+{
+	const int size = end - begin;
+	if (size <= 0) return;
+
+	float total = 0.f;
+	for (int i = begin; i < end; ++i)
+		total += weights[i];
+
+	// Scale weights so average is 1, and split into smaller and larger ones.
+	std::vector<int> small;
+	std::vector<int> large;
+
+	for (int i = begin; i < end; ++i)
+	{
+		weights[i] = total > 0.f ? weights[i] * size / total : 1.f;
+		(weights[i] < 1.f ? small : large).push_back(i);
+	}
+
+	// Each small entry is filled up to 1 by a large one.
+	while (!small.empty() && !large.empty())
+	{
+		const int less = small.back();
+		small.pop_back();
+		const int more = large.back();
+		large.pop_back();
+
+		probabilities[less] = weights[less];
+		aliases[less] = more;
+
+		weights[more] -= 1.f - weights[less];
+		(weights[more] < 1.f ? small : large).push_back(more);
+	}
+
+	// Left ones are 1 up to rounding error.
+	for (int i : small)
+	{
+		probabilities[i] = 1.f;
+		aliases[i] = i;
+	}
+
+	for (int i : large)
+	{
+		probabilities[i] = 1.f;
+		aliases[i] = i;
+	}
+}
+
+int PointSampler::SampleAliasTable(int begin, int end, const std::vector<float>& probabilities, const std::vector<int>& aliases)
+{
+	std::uniform_int_distribution<int> entry(begin, end - 1);
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+	const int picked = entry(m_random);
+	return unit(m_random) < probabilities[picked] ? picked : aliases[picked];
+}
+
+Point PointSampler::SampleTriangle(int triangle)
+{
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+	// Fold square into triangle, so barycentric point is uniform.
+	float u = unit(m_random);
+	float v = unit(m_random);
+	if (u + v > 1.f)
+	{
+		u = 1.f - u;
+		v = 1.f - v;
+	}
+
+	const Point& a = m_graph->GetVertex(triangle, 0);
+	const Point& b = m_graph->GetVertex(triangle, 1);
+	const Point& c = m_graph->GetVertex(triangle, 2);
+
+	return a + (b - a) * u + (c - a) * v;
+}
+
+float PointSampler::ComputeArea(int triangle) const
+{
+	return std::abs(TriArea(m_graph->GetVertex(triangle, 0), m_graph->GetVertex(triangle, 1), m_graph->GetVertex(triangle, 2))) / 2.f;
+}
\ No newline at end of file
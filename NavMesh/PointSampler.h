@@ -0,0 +1,186 @@
+/*!*******************************************************************
+\headerfile   PointSampler.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for PointSampler class which picks random
+			  points on navigation meshes.
+********************************************************************/
+#ifndef POINTSAMPLER_H
+#define POINTSAMPLER_H
+
+#include <vector>
+#include <random>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+
+/*!*******************************************************************
+\class PointSampler
+\brief
+	   Picks points uniformly by area. Triangles are chosen by alias
+	   tables built once for the graph, so each sample takes constant
+	   time. There is one table for each connected component of the
+	   graph, and one more to choose a component, so samples can be
+	   limited to the component of given triangle.
+	   Not thread-safe, since it owns random generator.
+********************************************************************/
+class PointSampler
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Build alias tables for given graph.
+
+	\param graph
+		   Graph to sample. Must not be moved or changed while this
+		   sampler uses it.
+
+	\param seed
+		   Seed of random generator.
+	********************************************************************/
+	void Initialize(const NavGraph& graph, unsigned seed = 0);
+
+	/*!*******************************************************************
+	\brief
+		   Pick random point on whole graph.
+
+	\param point
+		   Picked point is stored here.
+
+	\return int
+			Triangle including the point. -1 if graph is empty.
+	********************************************************************/
+	int Sample(Point& point);
+	/*!*******************************************************************
+	\brief
+		   Pick random point in the connected region of given triangle,
+		   so there is path to it from the triangle.
+
+	\param triangle
+		   Index of triangle in the region.
+
+	\param point
+		   Picked point is stored here.
+
+	\return int
+			Triangle including the point.
+	********************************************************************/
+	int SampleInRegion(int triangle, Point& point);
+	/*!*******************************************************************
+	\brief
+		   Pick random point within given distance from center, among
+		   triangles connected to the one including center.
+
+	\param center
+		   Center of the circle.
+
+	\param radius
+		   Radius of the circle.
+
+	\param point
+		   Picked point is stored here.
+
+	\return int
+			Triangle including the point. -1 if center is not inside of
+			polygon, or no sample hit the circle.
+	********************************************************************/
+	int SampleInCircle(const Point& center, float radius, Point& point);
+
+private:
+	/*!*******************************************************************
+	\struct Region
+	\brief
+		   Range of alias table for one connected region.
+	********************************************************************/
+	struct Region
+	{
+		int m_begin; //!< The first entry of the region.
+		int m_end; //!< The last entry of the region + 1.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Fill alias table entries of given range with given weights
+		   by Vose's method.
+
+	\param weights
+		   Weight of each entry. Changed while building.
+
+	\param begin
+		   The first entry.
+
+	\param end
+		   The last entry + 1.
+
+	\param probabilities
+		   Probability to keep each entry is stored here.
+
+	\param aliases
+		   Entry taken instead of each entry is stored here.
+	********************************************************************/
+	static void BuildAliasTable(std::vector<float>& weights, int begin, int end, std::vector<float>& probabilities, std::vector<int>& aliases);
+	/*!*******************************************************************
+	\brief
+		   Pick entry of alias table in given range.
+
+	\param begin
+		   The first entry.
+
+	\param end
+		   The last entry + 1.
+
+	\param probabilities
+		   Probability to keep each entry.
+
+	\param aliases
+		   Entry taken instead of each entry.
+
+	\return int
+			Picked entry.
+	********************************************************************/
+	int SampleAliasTable(int begin, int end, const std::vector<float>& probabilities, const std::vector<int>& aliases);
+	/*!*******************************************************************
+	\brief
+		   Pick uniform point inside of given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\return Point
+			Picked point.
+	********************************************************************/
+	Point SampleTriangle(int triangle);
+	/*!*******************************************************************
+	\brief
+		   Compute area of given triangle.
+
+	\param triangle
+		   Index of triangle.
+
+	\return float
+			Area of triangle.
+	********************************************************************/
+	float ComputeArea(int triangle) const;
+
+private:
+	const NavGraph* m_graph = nullptr; //!< Graph to sample. Only read.
+	std::mt19937 m_random; //!< Random generator.
+
+	std::vector<int> m_triangles; //!< Triangles sorted by region. Entries of alias table.
+	std::vector<float> m_probabilities; //!< Probability to keep each entry.
+	std::vector<int> m_aliases; //!< Entry taken instead of each entry.
+
+	std::vector<Region> m_regions; //!< Range of entries of each region.
+	std::vector<float> m_regionProbabilities; //!< Alias table to choose region by area.
+	std::vector<int> m_regionAliases; //!< Alias table to choose region by area.
+
+	std::vector<int> m_candidates; //!< Triangles overlapping circle. Reused for every circle.
+	std::vector<float> m_cumulativeAreas; //!< Sum of areas of candidates until each one. Reused for every circle.
+	std::vector<unsigned> m_marks; //!< Iteration which each triangle was found by circle.
+	unsigned m_iteration = 0; //!< Counter for circle, so marks do not have to be cleared.
+};
+
+#endif // !POINTSAMPLER_H
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*!*******************************************************************
+\file		  QueryFilter.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <algorithm>
+
+#include "QueryFilter.h"
+
+static_assert(NavGraph::MaxAreas <= 32, "Every area type needs a bit of include mask.");
+
+QueryFilter::QueryFilter()
+	: m_includeMask(~0u), m_minCost(1.f), m_includesLinks(true)
+{
+	std::fill(m_costs, m_costs + NavGraph::MaxAreas, 1.f);
+
+	m_includeMask &= ~(1u << NavGraph::WallArea);
+	m_includeMask &= ~(1u << Forbidden);
+}
+
+void QueryFilter::SetCost(int area, float cost)
+{
+	m_costs[area] = std::max(cost, 0.f);
+	UpdateMinCost();
+}
+
+float QueryFilter::GetCost(int area) const
+{
+	return m_costs[area];
+}
+
+void QueryFilter::SetIncluded(int area, bool isIncluded)
+{
+	if (isIncluded && area != NavGraph::WallArea)
+		m_includeMask |= 1u << area;
+	else
+		m_includeMask &= ~(1u << area);
+
+	UpdateMinCost();
+}
+
+bool QueryFilter::IsIncluded(int area) const
+{
+	return (m_includeMask >> area) & 1u;
+}
+
+float QueryFilter::GetMinCost() const
+{
+	return m_minCost;
+}
+
+void QueryFilter::SetOffMeshLinksIncluded(bool isIncluded)
+{
+	m_includesLinks = isIncluded;
+}
+
+bool QueryFilter::AreOffMeshLinksIncluded() const
+{
+	return m_includesLinks;
+}
+
+void QueryFilter::UpdateMinCost()
+{
+	// Without any included area, nothing is searched anyway.
+	m_minCost = 1.f;
+	bool isFirst = true;
+
+	for (int i = 0; i < NavGraph::MaxAreas; ++i)
+	{
+		if (!IsIncluded(i)) continue;
+
+		m_minCost = isFirst ? m_costs[i] : std::min(m_minCost, m_costs[i]);
+		isFirst = false;
+	}
+}
\ No newline at end of file
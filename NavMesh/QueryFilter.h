@@ -0,0 +1,136 @@
+/*!*******************************************************************
+\headerfile   QueryFilter.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for QueryFilter class which decides cost
+			  and passability of area types for a query.
+********************************************************************/
+#ifndef QUERYFILTER_H
+#define QUERYFILTER_H
+
+#include "NavGraph.h"
+
+/*!*******************************************************************
+\class QueryFilter
+\brief
+	   Cost multiplier and inclusion of each area type. Small enough
+	   to be copied into each query. Area types are just numbers, and
+	   Area gives names to common ones.
+	   Walls are an area type which is never included, so searches
+	   skip walls and excluded areas by the same test.
+********************************************************************/
+class QueryFilter
+{
+public:
+	/*!*******************************************************************
+	\enum Area
+	\brief
+		   Names of common area types.
+	********************************************************************/
+	enum Area
+	{
+		Ground = 0, //!< Default of every triangle.
+		Road,
+		Mud,
+		Water,
+		Forbidden //!< Excluded by default.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Constructor that sets every cost to 1, and includes every
+		   area type except Forbidden, and off-mesh links.
+	********************************************************************/
+	QueryFilter();
+
+	/*!*******************************************************************
+	\brief
+		   Setter method for cost multiplier of given area type.
+		   Distance walked inside of the area is multiplied by it.
+
+	\param area
+		   Area type.
+
+	\param cost
+		   New multiplier. Negative one is treated as 0.
+	********************************************************************/
+	void SetCost(int area, float cost);
+	/*!*******************************************************************
+	\brief
+		   Getter method for cost multiplier of given area type.
+
+	\param area
+		   Area type.
+
+	\return float
+			Multiplier of the area.
+	********************************************************************/
+	float GetCost(int area) const;
+	/*!*******************************************************************
+	\brief
+		   Include or exclude given area type. Excluded areas are never
+		   entered.
+
+	\param area
+		   Area type. NavGraph::WallArea cannot be included.
+
+	\param isIncluded
+		   True to include.
+	********************************************************************/
+	void SetIncluded(int area, bool isIncluded);
+	/*!*******************************************************************
+	\brief
+		   Check whether given area type can be entered.
+
+	\param area
+		   Area type.
+
+	\return bool
+			True if area is included.
+	********************************************************************/
+	bool IsIncluded(int area) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the smallest multiplier among included
+		   areas. Heuristic is scaled by it, so it never overestimates.
+
+	\return float
+			The smallest multiplier.
+	********************************************************************/
+	float GetMinCost() const;
+
+	/*!*******************************************************************
+	\brief
+		   Include or exclude off-mesh links. Users which only walk on
+		   triangles, like PathCorridor, should exclude them.
+
+	\param isIncluded
+		   True to include.
+	********************************************************************/
+	void SetOffMeshLinksIncluded(bool isIncluded);
+	/*!*******************************************************************
+	\brief
+		   Check whether off-mesh links can be used.
+
+	\return bool
+			True if links are included.
+	********************************************************************/
+	bool AreOffMeshLinksIncluded() const;
+
+private:
+	/*!*******************************************************************
+	\brief
+		   Compute the smallest multiplier among included areas again.
+	********************************************************************/
+	void UpdateMinCost();
+
+private:
+	float m_costs[NavGraph::MaxAreas]; //!< Cost multiplier of each area type.
+	unsigned m_includeMask; //!< Bit of each included area type.
+	float m_minCost; //!< The smallest multiplier among included areas.
+	bool m_includesLinks; //!< True if off-mesh links can be used.
+};
+
+#endif // !QUERYFILTER_H
\ No newline at end of file
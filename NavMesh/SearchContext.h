@@ -0,0 +1,220 @@
+/*!*******************************************************************
+\headerfile   SearchContext.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for SearchContext class which keeps state
+			  of nodes and open list for searching on NavGraph.
+********************************************************************/
+#ifndef SEARCHCONTEXT_H
+#define SEARCHCONTEXT_H
+
+#include <vector>
+#include <functional>
+
+#include "BinaryHeap.h"
+
+/*!*******************************************************************
+\struct SearchNode
+\brief
+	   Per search state of one triangle. Only what is touched while
+	   relaxing neighbors, packed into 16 bytes.
+********************************************************************/
+struct SearchNode
+{
+	/*!*******************************************************************
+	\enum Status
+	\brief
+		   Indicates the list which this node is involved.
+	********************************************************************/
+	enum class Status : unsigned
+	{
+		Default,
+		Open,
+		Closed,
+		Visited //!< Closed by previous pass of anytime search, and may be opened again.
+	};
+
+	SearchNode() : m_iteration(0), m_status(0), m_portal(3) {}
+
+	float m_cost = 0.f; //!< Sum of given cost and heurstic.
+	float m_given = 0.f; //!< The actual cost took to come here from the root.
+	int m_parent = -1; //!< Index of parent triangle. -1 for the root. Will be used to restore the path.
+	unsigned m_iteration : 28; //!< Indicates whether this node has been used in current search. If it has old value, this node needs to be clear.
+	unsigned m_status : 2; //!< Status of this node.
+	unsigned m_portal : 2; //!< Index of edge of this triangle shared with parent. 3 for the root, or node reached by off-mesh link.
+};
+
+static_assert(sizeof(SearchNode) == 16, "SearchNode must be kept in 16 bytes.");
+
+/*!*******************************************************************
+\class BasicSearchContext
+\brief
+	   Nodes and open list of searches on one graph. Nodes are
+	   reset lazily by iteration counter, so starting new search
+	   does not touch all nodes.
+	   Open list is a policy with same methods as BinaryHeap, so
+	   each type is inlined into searches using it.
+********************************************************************/
+template <class OpenList>
+class BasicSearchContext
+{
+public:
+	static constexpr int NoPortal = 3; //!< Portal of the root node.
+	static constexpr int LinkPortal = NoPortal; //!< Portal of node reached by off-mesh link. Only the root has no parent, so it is not mixed with NoPortal.
+
+	/*!*******************************************************************
+	\brief
+		   Make nodes for given number of triangles and reset them.
+
+	\param count
+		   The number of triangles of the graph.
+	********************************************************************/
+	void Initialize(int count);
+	/*!*******************************************************************
+	\brief
+		   Start new search. All nodes become Default, and open list
+		   gets empty.
+	********************************************************************/
+	void Clear();
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of nodes.
+
+	\return int
+			The number of triangles this context was initialized for.
+	********************************************************************/
+	int GetNodeCount() const;
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for status of given node in current search.
+
+	\param node
+		   Index of node.
+
+	\return SearchNode::Status
+			Default if node has not been touched by current search.
+	********************************************************************/
+	SearchNode::Status GetStatus(int node) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for state of given node.
+		   Only valid if status is not Default.
+
+	\param node
+		   Index of node.
+
+	\return const SearchNode&
+			State of the node.
+	********************************************************************/
+	const SearchNode& GetNode(int node) const;
+
+	/*!*******************************************************************
+	\brief
+		   Push given node into open list, or move it if it is already
+		   inside with higher cost.
+
+	\param node
+		   Index of node.
+
+	\param parent
+		   Index of parent node. -1 for the root.
+
+	\param portal
+		   Index of edge of given node shared with parent.
+
+	\param given
+		   The actual cost from the root.
+
+	\param cost
+		   Given cost plus heuristic.
+	********************************************************************/
+	void Open(int node, int parent, int portal, float given, float cost);
+	/*!*******************************************************************
+	\brief
+		   Close node has the lowest cost.
+
+	\return int
+			Index of closed node.
+	********************************************************************/
+	int Close();
+	/*!*******************************************************************
+	\brief
+		   Change state of given node without touching open list. Used
+		   for closed node improved during anytime search.
+
+	\param node
+		   Index of node. Must not be in open list.
+
+	\param parent
+		   Index of parent node.
+
+	\param portal
+		   Index of edge of given node shared with parent.
+
+	\param given
+		   The actual cost from the root.
+
+	\param cost
+		   Given cost plus heuristic.
+	********************************************************************/
+	void Update(int node, int parent, int portal, float given, float cost);
+	/*!*******************************************************************
+	\brief
+		   Change closed node to Visited, so next pass of anytime search
+		   can open it again. Its state is kept.
+
+	\param node
+		   Index of closed node.
+	********************************************************************/
+	void MarkVisited(int node);
+	/*!*******************************************************************
+	\brief
+		   Getter method for the lowest cost in open list.
+		   Open list must not be empty.
+
+	\return float
+			Cost of the node Close would return.
+	********************************************************************/
+	float GetMinCost() const;
+	/*!*******************************************************************
+	\brief
+		   Telling whether open list is empty or not.
+
+	\return bool
+			If there is no node in open list, returns true.
+			Otherwise, return false.
+	********************************************************************/
+	bool IsOpenListEmpty() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of nodes in open list.
+
+	\return int
+			The number of open nodes.
+	********************************************************************/
+	int GetOpenCount() const;
+	/*!*******************************************************************
+	\brief
+		   Recompute cost of every node in open list and sort again.
+
+	\param computeCost
+		   Function returns new cost of node with given index.
+	********************************************************************/
+	void Rebuild(const std::function<float(int)>& computeCost);
+
+private:
+	static constexpr unsigned MaxIteration = (1u << 28) - 1; //!< The biggest value fits in SearchNode::m_iteration.
+
+	std::vector<SearchNode> m_nodes; //!< State of each triangle. Same order with graph.
+	OpenList m_openList; //!< Open list of current search.
+	unsigned m_iteration = 0; //!< Indicates how many searches proceeded. Nodes having other value are Default.
+};
+
+using SearchContext = BasicSearchContext<BinaryHeap>; //!< Context used by queries of this project.
+
+#include "SearchContext.hpp"
+
+#endif // !SEARCHCONTEXT_H
\ No newline at end of file
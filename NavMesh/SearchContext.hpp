@@ -0,0 +1,125 @@
+/*!*******************************************************************
+\headerfile   SearchContext.hpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include "SearchContext.h"
+
+template <class OpenList>
+void BasicSearchContext<OpenList>::Initialize(int count)
+{
+	m_nodes = std::vector<SearchNode>(count);
+	m_openList.Clear();
+	m_iteration = 0;
+}
+
+template <class OpenList>
+void BasicSearchContext<OpenList>::Clear()
+{
+	m_openList.Clear();
+
+	// Counter is running out. Reset all nodes once, and start counting again.
+	if (++m_iteration > MaxIteration)
+	{
+		for (auto& node : m_nodes)
+			node.m_iteration = 0;
+
+		m_iteration = 1;
+	}
+}
+
+template <class OpenList>
+int BasicSearchContext<OpenList>::GetNodeCount() const
+{
+	return static_cast<int>(m_nodes.size());
+}
+
+template <class OpenList>
+SearchNode::Status BasicSearchContext<OpenList>::GetStatus(int node) const
+{
+	const auto& searchNode = m_nodes[node];
+	if (searchNode.m_iteration != m_iteration)
+		return SearchNode::Status::Default;
+
+	return static_cast<SearchNode::Status>(searchNode.m_status);
+}
+
+template <class OpenList>
+const SearchNode& BasicSearchContext<OpenList>::GetNode(int node) const
+{
+	return m_nodes[node];
+}
+
+template <class OpenList>
+void BasicSearchContext<OpenList>::Open(int node, int parent, int portal, float given, float cost)
+{
+	auto& searchNode = m_nodes[node];
+
+	// Already inside open list. Move to new position.
+	if (GetStatus(node) == SearchNode::Status::Open)
+		m_openList.DecreaseKey(node, searchNode.m_cost, cost);
+	else
+	{
+		searchNode.m_iteration = m_iteration;
+		searchNode.m_status = static_cast<unsigned>(SearchNode::Status::Open);
+		m_openList.Insert(node, cost);
+	}
+
+	searchNode.m_cost = cost;
+	searchNode.m_given = given;
+	searchNode.m_parent = parent;
+	searchNode.m_portal = static_cast<unsigned>(portal);
+}
+
+template <class OpenList>
+int BasicSearchContext<OpenList>::Close()
+{
+	const int node = m_openList.GetTop();
+	m_nodes[node].m_status = static_cast<unsigned>(SearchNode::Status::Closed);
+
+	return node;
+}
+
+template <class OpenList>
+void BasicSearchContext<OpenList>::Update(int node, int parent, int portal, float given, float cost)
+{
+	auto& searchNode = m_nodes[node];
+
+	searchNode.m_cost = cost;
+	searchNode.m_given = given;
+	searchNode.m_parent = parent;
+	searchNode.m_portal = static_cast<unsigned>(portal);
+}
+
+template <class OpenList>
+void BasicSearchContext<OpenList>::MarkVisited(int node)
+{
+	m_nodes[node].m_status = static_cast<unsigned>(SearchNode::Status::Visited);
+}
+
+template <class OpenList>
+float BasicSearchContext<OpenList>::GetMinCost() const
+{
+	return m_openList.GetTopCost();
+}
+
+template <class OpenList>
+bool BasicSearchContext<OpenList>::IsOpenListEmpty() const
+{
+	return m_openList.Empty();
+}
+
+template <class OpenList>
+int BasicSearchContext<OpenList>::GetOpenCount() const
+{
+	return m_openList.Size();
+}
+
+template <class OpenList>
+void BasicSearchContext<OpenList>::Rebuild(const std::function<float(int)>& computeCost)
+{
+	m_openList.Rebuild([this, &computeCost](int node) {
+		return m_nodes[node].m_cost = computeCost(node);
+	});
+}
\ No newline at end of file
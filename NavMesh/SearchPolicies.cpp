@@ -0,0 +1,175 @@
+/*!*******************************************************************
+\file		  SearchPolicies.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <limits>
+
+#include "SearchPolicies.h"
+#include "SearchContext.h"
+
+namespace
+{
+	/*!*******************************************************************
+	\brief
+		   Collect points search walks through inside of triangle:
+		   middle points of its portals and ends of its off-mesh links.
+		   Middle point of edge is triangle * 3 + edge. End of link is
+		   triangle count * 3 + link * 2, plus 1 for its end point.
+	********************************************************************/
+	void GetPoints(const NavGraph& graph, int triangle, std::vector<int>& points)
+	{
+		points.clear();
+
+		for (int i = 0; i < 3; ++i)
+		{
+			if (graph.GetNeighbor(triangle, i) >= 0)
+				points.push_back(triangle * 3 + i);
+		}
+
+		const int linkBase = graph.GetTriangleCount() * 3;
+		const int count = graph.GetLinkCount(triangle);
+		for (int i = 0; i < count; ++i)
+		{
+			const int link = graph.GetLink(triangle, i);
+			const auto& offMeshLink = graph.GetOffMeshLink(link);
+
+			if (offMeshLink.m_startTriangle == triangle)
+				points.push_back(linkBase + link * 2);
+			if (offMeshLink.m_endTriangle == triangle)
+				points.push_back(linkBase + link * 2 + 1);
+		}
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Get position of point numbered as GetPoints.
+	********************************************************************/
+	const Point& GetPosition(const NavGraph& graph, int point)
+	{
+		const int linkBase = graph.GetTriangleCount() * 3;
+		if (point < linkBase)
+			return graph.GetMidpoint(point / 3, point % 3);
+
+		const auto& offMeshLink = graph.GetOffMeshLink((point - linkBase) / 2);
+		return (point - linkBase) % 2 != 0 ? offMeshLink.m_end : offMeshLink.m_start;
+	}
+
+	/*!*******************************************************************
+	\brief
+		   Get triangle including point numbered as GetPoints.
+	********************************************************************/
+	int GetPointTriangle(const NavGraph& graph, int point)
+	{
+		const int linkBase = graph.GetTriangleCount() * 3;
+		if (point < linkBase)
+			return point / 3;
+
+		const auto& offMeshLink = graph.GetOffMeshLink((point - linkBase) / 2);
+		return (point - linkBase) % 2 != 0 ? offMeshLink.m_endTriangle : offMeshLink.m_startTriangle;
+	}
+}
+
+void LandmarkHeuristic::Build(const NavGraph& graph, int landmarkCount)
+{
+	const int size = graph.GetTriangleCount();
+	const int linkBase = size * 3;
+
+	m_landmarkCount = size > 0 ? std::max(landmarkCount, 0) : 0;
+	m_portalDistances.assign(size * 3 * m_landmarkCount, -1.f);
+	m_ranges.assign(size * 2 * m_landmarkCount, -1.f);
+	m_goalRanges.assign(m_landmarkCount * 2, -1.f);
+
+	// One node for each point. Off-mesh links are walked both ways, so distance stays symmetric for triangle inequality.
+	SearchContext context;
+	context.Initialize(linkBase + graph.GetOffMeshLinkCount() * 2);
+
+	std::vector<int> points;
+	std::vector<int> others;
+
+	// Distance to the closest landmark so far. Next landmark is the farthest triangle from all of them.
+	std::vector<float> nearest(size, std::numeric_limits<float>::max());
+	int landmark = 0;
+
+	for (int i = 0; i < m_landmarkCount; ++i)
+	{
+		// Search leaves landmark from any of its points.
+		context.Clear();
+		GetPoints(graph, landmark, points);
+		for (int point : points)
+			context.Open(point, -1, SearchContext::NoPortal, 0.f, 0.f);
+
+		while (!context.IsOpenListEmpty())
+		{
+			const int point = context.Close();
+			const float given = context.GetNode(point).m_given;
+			const Point& position = GetPosition(graph, point);
+
+			auto relax = [&](int next, float new_given) {
+				const auto status = context.GetStatus(next);
+				if (status == SearchNode::Status::Closed) return;
+
+				if (status == SearchNode::Status::Default || new_given < context.GetNode(next).m_given)
+					context.Open(next, point, SearchContext::NoPortal, new_given, new_given);
+			};
+
+			// Middle point is shared with twin edge. End of link leads to its other end.
+			if (point < linkBase)
+			{
+				const int triangle = point / 3;
+				const int edge = point % 3;
+				relax(graph.GetNeighbor(triangle, edge) * 3 + graph.GetTwin(triangle, edge), given);
+			}
+			else
+			{
+				const auto& offMeshLink = graph.GetOffMeshLink((point - linkBase) / 2);
+				relax(linkBase + ((point - linkBase) ^ 1), given + DistanceBetween(offMeshLink.m_start, offMeshLink.m_end));
+			}
+
+			// Walk straight to other points of same triangle, as search does.
+			GetPoints(graph, GetPointTriangle(graph, point), others);
+			for (int other : others)
+			{
+				if (other != point)
+					relax(other, given + DistanceBetween(position, GetPosition(graph, other)));
+			}
+		}
+
+		for (int triangle = 0; triangle < size; ++triangle)
+		{
+			GetPoints(graph, triangle, points);
+
+			// Triangle search cannot walk through. Never worth a landmark.
+			if (points.empty())
+				nearest[triangle] = 0.f;
+
+			float* range = &m_ranges[(triangle * m_landmarkCount + i) * 2];
+			for (int point : points)
+			{
+				if (context.GetStatus(point) != SearchNode::Status::Closed) continue;
+
+				const float distance = context.GetNode(point).m_given;
+				if (point < linkBase)
+					m_portalDistances[point * m_landmarkCount + i] = distance;
+
+				range[0] = range[0] < 0.f ? distance : std::min(range[0], distance);
+				range[1] = std::max(range[1], distance);
+			}
+
+			if (range[0] >= 0.f)
+				nearest[triangle] = std::min(nearest[triangle], range[0]);
+		}
+
+		// Triangles not reached by any landmark yet are the farthest.
+		landmark = static_cast<int>(std::max_element(nearest.begin(), nearest.end()) - nearest.begin());
+	}
+}
+
+void LandmarkHeuristic::SetGoal(const Point& goal, int triangle)
+{
+	m_goal = goal;
+
+	for (int i = 0; i < m_landmarkCount * 2; ++i)
+		m_goalRanges[i] = m_ranges[triangle * m_landmarkCount * 2 + i];
+}
\ No newline at end of file
@@ -0,0 +1,257 @@
+/*!*******************************************************************
+\headerfile   SearchPolicies.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for heuristic and cost policies which
+			  BasicPathQuery is built from.
+********************************************************************/
+#ifndef SEARCHPOLICIES_H
+#define SEARCHPOLICIES_H
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "Point.h"
+
+#include "NavGraph.h"
+#include "QueryFilter.h"
+
+/*!*******************************************************************
+\class ZeroHeuristic
+\brief
+	   Estimates nothing, so search becomes Dijkstra.
+********************************************************************/
+class ZeroHeuristic
+{
+public:
+	void SetGoal(const Point&, int) {}
+	float Estimate(const Point&, int, int) const { return 0.f; }
+};
+
+/*!*******************************************************************
+\class EuclideanHeuristic
+\brief
+	   Straight distance to goal. Never overestimates.
+********************************************************************/
+class EuclideanHeuristic
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Set point every estimate is measured to.
+
+	\param goal
+		   Destination point.
+
+	\param triangle
+		   Triangle including goal. Not used.
+	********************************************************************/
+	void SetGoal(const Point& goal, int /*triangle*/) { m_goal = goal; }
+	/*!*******************************************************************
+	\brief
+		   Estimate cost from given position to goal.
+
+	\param position
+		   Point to estimate from.
+
+	\param triangle
+		   Triangle including position. Not used.
+
+	\param edge
+		   Edge of triangle position is middle point of. Not used.
+
+	\return float
+			Distance to goal.
+	********************************************************************/
+	float Estimate(const Point& position, int /*triangle*/, int /*edge*/) const { return DistanceBetween(position, m_goal); }
+
+private:
+	Point m_goal; //!< Destination point.
+};
+
+/*!*******************************************************************
+\class OctileHeuristic
+\brief
+	   Octile distance to goal, which PathQuery uses. Cheaper
+	   than square root, but may overestimate slightly.
+********************************************************************/
+class OctileHeuristic
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Set point every estimate is measured to.
+
+	\param goal
+		   Destination point.
+
+	\param triangle
+		   Triangle including goal. Not used.
+	********************************************************************/
+	void SetGoal(const Point& goal, int /*triangle*/) { m_goal = goal; }
+	/*!*******************************************************************
+	\brief
+		   Estimate cost from given position to goal.
+
+	\param position
+		   Point to estimate from.
+
+	\param triangle
+		   Triangle including position. Not used.
+
+	\param edge
+		   Edge of triangle position is middle point of. Not used.
+
+	\return float
+			Octile distance to goal.
+	********************************************************************/
+	float Estimate(const Point& position, int /*triangle*/, int /*edge*/) const
+	{
+		const float dx = std::abs(m_goal.X - position.X);
+		const float dy = std::abs(m_goal.Y - position.Y);
+
+		const float shorter = std::min(dx, dy);
+		return shorter * 1.41421356f + std::max(dx, dy) - shorter;
+	}
+
+private:
+	Point m_goal; //!< Destination point.
+};
+
+/*!*******************************************************************
+\class LandmarkHeuristic
+\brief
+	   Landmark heuristic (ALT). Shortest distances from a few
+	   landmark triangles to every portal are computed once, under
+	   same model search walks by: straight lines between middle
+	   points of edges and ends of off-mesh links. Triangle
+	   inequality gives lower bound of distance to the portals of
+	   goal triangle, so it never overestimates once scaled by the
+	   cheapest cost, same as straight distance. Much tighter than
+	   straight distance around obstacles.
+	   Must be built again after off-mesh links are changed.
+********************************************************************/
+class LandmarkHeuristic
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Choose landmarks far from each other, and compute distances
+		   from them to every portal by Dijkstra.
+
+	\param graph
+		   Graph to search on.
+
+	\param landmarkCount
+		   The number of landmarks. Each costs five floats per
+		   triangle.
+	********************************************************************/
+	void Build(const NavGraph& graph, int landmarkCount);
+	/*!*******************************************************************
+	\brief
+		   Set point every estimate is measured to.
+
+	\param goal
+		   Destination point.
+
+	\param triangle
+		   Triangle including goal.
+	********************************************************************/
+	void SetGoal(const Point& goal, int triangle);
+	/*!*******************************************************************
+	\brief
+		   Estimate cost from given position to goal.
+
+	\param position
+		   Point to estimate from.
+
+	\param triangle
+		   Triangle including position.
+
+	\param edge
+		   Edge of triangle position is middle point of. If it is
+		   negative, range of distances of the whole triangle is used.
+
+	\return float
+			The biggest lower bound among landmarks and straight
+			distance.
+	********************************************************************/
+	float Estimate(const Point& position, int triangle, int edge) const
+	{
+		float estimate = DistanceBetween(position, m_goal);
+
+		const float* ranges = &m_ranges[triangle * m_landmarkCount * 2];
+		const float* portals = edge >= 0 ? &m_portalDistances[(triangle * 3 + edge) * m_landmarkCount] : nullptr;
+
+		for (int i = 0; i < m_landmarkCount; ++i)
+		{
+			// Landmark cannot reach goal triangle. Tells nothing.
+			const float goalMin = m_goalRanges[i * 2];
+			const float goalMax = m_goalRanges[i * 2 + 1];
+			if (goalMin < 0.f) continue;
+
+			// Distance of portal is exact. Other points leave triangle through one of its portals.
+			float low = ranges[i * 2];
+			float high = ranges[i * 2 + 1];
+			if (portals && portals[i] >= 0.f)
+				low = high = portals[i];
+			else if (low < 0.f)
+				continue;
+
+			estimate = std::max(estimate, std::max(goalMin - high, low - goalMax));
+		}
+
+		return estimate;
+	}
+
+private:
+	int m_landmarkCount = 0; //!< The number of landmarks.
+	std::vector<float> m_portalDistances; //!< Distance from each landmark to middle point of each edge, grouped by edge. Negative for walls or if not reachable.
+	std::vector<float> m_ranges; //!< The smallest and the biggest distance from each landmark to portals and ends of links of each triangle, grouped by triangle. Negative if not reachable.
+	std::vector<float> m_goalRanges; //!< Ranges of goal triangle, copied so estimate reads one row.
+	Point m_goal; //!< Destination point.
+};
+
+/*!*******************************************************************
+\class DistanceCost
+\brief
+	   Cost is distance walked. Costs of areas are ignored, but
+	   excluded areas and walls are still never entered.
+	   Cost models take passability from filter, and decide cost of
+	   each area type.
+********************************************************************/
+class DistanceCost
+{
+public:
+	void SetFilter(const QueryFilter& filter) { m_filter = filter; }
+	bool IsIncluded(int area) const { return m_filter.IsIncluded(area); }
+	bool AreOffMeshLinksIncluded() const { return m_filter.AreOffMeshLinksIncluded(); }
+	float GetCost(int /*area*/) const { return 1.f; }
+	float GetMinCost() const { return 1.f; }
+
+private:
+	QueryFilter m_filter; //!< Passability of area types.
+};
+
+/*!*******************************************************************
+\class FilterCost
+\brief
+	   Cost is distance times cost of area from filter.
+********************************************************************/
+class FilterCost
+{
+public:
+	void SetFilter(const QueryFilter& filter) { m_filter = filter; }
+	bool IsIncluded(int area) const { return m_filter.IsIncluded(area); }
+	bool AreOffMeshLinksIncluded() const { return m_filter.AreOffMeshLinksIncluded(); }
+	float GetCost(int area) const { return m_filter.GetCost(area); }
+	float GetMinCost() const { return m_filter.GetMinCost(); }
+
+private:
+	QueryFilter m_filter; //!< Cost and passability of area types.
+};
+
+#endif // !SEARCHPOLICIES_H
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*!*******************************************************************
+\file		  SearchStats.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <cmath>
+#include <algorithm>
+
+#include "SearchStats.h"
+
+SearchStatsHistogram::SearchStatsHistogram()
+{
+	Clear();
+}
+
+void SearchStatsHistogram::Add(const SearchStats& stats)
+{
+	const float values[MetricCount] = {
+		static_cast<float>(stats.m_expanded),
+		static_cast<float>(stats.m_pushes),
+		static_cast<float>(stats.m_decreaseKeys),
+		static_cast<float>(stats.m_maxOpenSize),
+		static_cast<float>(stats.m_funnelIterations),
+		static_cast<float>(stats.m_portals),
+		stats.m_locateMicroseconds,
+		stats.m_searchMicroseconds,
+		stats.m_restoreMicroseconds,
+		stats.m_funnelMicroseconds
+	};
+
+	for (int i = 0; i < MetricCount; ++i)
+	{
+		// Exponent of 2 is the bucket. Values below 1 go to the first one.
+		int bucket = 0;
+		if (values[i] >= 1.f)
+		{
+			int exponent;
+			std::frexp(values[i], &exponent);
+			bucket = std::min(exponent, BucketCount - 1);
+		}
+
+		++m_buckets[i][bucket];
+		m_sums[i] += values[i];
+		m_maxima[i] = std::max(m_maxima[i], values[i]);
+	}
+
+	++m_count;
+}
+
+void SearchStatsHistogram::Merge(const SearchStatsHistogram& other)
+{
+	for (int i = 0; i < MetricCount; ++i)
+	{
+		for (int j = 0; j < BucketCount; ++j)
+			m_buckets[i][j] += other.m_buckets[i][j];
+
+		m_sums[i] += other.m_sums[i];
+		m_maxima[i] = std::max(m_maxima[i], other.m_maxima[i]);
+	}
+
+	m_count += other.m_count;
+}
+
+void SearchStatsHistogram::Clear()
+{
+	std::fill(&m_buckets[0][0], &m_buckets[0][0] + MetricCount * BucketCount, 0);
+	std::fill(m_sums, m_sums + MetricCount, 0.0);
+	std::fill(m_maxima, m_maxima + MetricCount, 0.f);
+	m_count = 0;
+}
+
+int SearchStatsHistogram::GetQueryCount() const
+{
+	return m_count;
+}
+
+int SearchStatsHistogram::GetBucket(Metric metric, int bucket) const
+{
+	return m_buckets[metric][bucket];
+}
+
+float SearchStatsHistogram::GetBucketLimit(int bucket)
+{
+	return std::ldexp(1.f, bucket);
+}
+
+float SearchStatsHistogram::GetMean(Metric metric) const
+{
+	return m_count > 0 ? static_cast<float>(m_sums[metric] / m_count) : 0.f;
+}
+
+float SearchStatsHistogram::GetMax(Metric metric) const
+{
+	return m_maxima[metric];
+}
+
+float SearchStatsHistogram::GetPercentile(Metric metric, float ratio) const
+{
+	if (m_count == 0) return 0.f;
+
+	// Walk buckets until enough queries are below.
+	const float target = std::min(std::max(ratio, 0.f), 1.f) * m_count;
+	int below = 0;
+
+	for (int i = 0; i < BucketCount; ++i)
+	{
+		below += m_buckets[metric][i];
+		if (below >= target && below > 0)
+			return std::min(GetBucketLimit(i), m_maxima[metric]);
+	}
+
+	return m_maxima[metric];
+}
+
+const char* SearchStatsHistogram::GetName(Metric metric)
+{
+	static const char* const names[MetricCount] = {
+		"expanded",
+		"pushes",
+		"decrease keys",
+		"max open size",
+		"funnel iterations",
+		"portals",
+		"locate us",
+		"search us",
+		"restore us",
+		"funnel us"
+	};
+
+	return names[metric];
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+/*!*******************************************************************
+\headerfile   SearchStats.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for SearchStats struct which counts work
+			  done by one path query, and histograms of them.
+********************************************************************/
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+
+#include <chrono>
+
+// Define as 0 to compile statistics out. Every counter is behind constant condition then, so nothing is left.
+#ifndef NAVMESH_SEARCH_STATS
+#define NAVMESH_SEARCH_STATS 1
+#endif
+
+/*!*******************************************************************
+\struct SearchStats
+\brief
+	   Work done by one query, from new start or end point until
+	   path is found, including improvements of anytime search.
+	   Times are exclusive, so search time does not include
+	   restoring path, and restoring does not include funnel.
+********************************************************************/
+struct SearchStats
+{
+	static const bool IsEnabled = NAVMESH_SEARCH_STATS != 0; //!< Queries skip counting code if it is false.
+
+	int m_expanded = 0; //!< The number of closed nodes.
+	int m_pushes = 0; //!< The number of nodes inserted into open list.
+	int m_decreaseKeys = 0; //!< The number of nodes moved inside of open list by lower cost.
+	int m_maxOpenSize = 0; //!< The biggest size of open list.
+	int m_funnelIterations = 0; //!< The number of portals visited by funnel, including those visited again after a corner.
+	int m_portals = 0; //!< The number of portals given to funnel.
+
+	float m_locateMicroseconds = 0.f; //!< Time taken to find triangles of start and end points.
+	float m_searchMicroseconds = 0.f; //!< Time taken by A* search.
+	float m_restoreMicroseconds = 0.f; //!< Time taken to follow parents and compute portals.
+	float m_funnelMicroseconds = 0.f; //!< Time taken by funnel algorithm.
+};
+
+/*!*******************************************************************
+\class StatsTimer
+\brief
+	   Adds time of its scope to a phase of SearchStats. Time is
+	   removed from enclosing phase, so phases do not count same
+	   time twice. Does nothing if statistics are compiled out.
+********************************************************************/
+class StatsTimer
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Constructor that starts measuring.
+
+	\param time
+		   Phase time is added to.
+
+	\param parent
+		   Phase enclosing this one. Time is removed from it. Can be
+		   null.
+	********************************************************************/
+	StatsTimer(float& time, float* parent = nullptr) : m_time(time), m_parent(parent)
+	{
+		if (SearchStats::IsEnabled)
+			m_begin = Clock::now();
+	}
+	/*!*******************************************************************
+	\brief
+		   Destructor that adds elapsed time.
+	********************************************************************/
+	~StatsTimer()
+	{
+		if (!SearchStats::IsEnabled) return;
+
+		const std::chrono::duration<float, std::micro> elapsed = Clock::now() - m_begin;
+		m_time += elapsed.count();
+		if (m_parent)
+			*m_parent -= elapsed.count();
+	}
+
+	StatsTimer(const StatsTimer&) = delete;
+	StatsTimer& operator=(const StatsTimer&) = delete;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	float& m_time; //!< Phase time is added to.
+	float* m_parent; //!< Phase time is removed from.
+	Clock::time_point m_begin; //!< When measuring started.
+};
+
+/*!*******************************************************************
+\class SearchStatsHistogram
+\brief
+	   Distribution of each statistic across many queries. Buckets
+	   grow by powers of two, so both tiny and huge queries fit in
+	   fixed size. Bucket 0 has values below 1, and bucket i has
+	   values from 2^(i-1) to 2^i.
+********************************************************************/
+class SearchStatsHistogram
+{
+public:
+	/*!*******************************************************************
+	\enum Metric
+	\brief
+		   Statistics kept in histograms. Same order with SearchStats.
+	********************************************************************/
+	enum Metric
+	{
+		Expanded,
+		Pushes,
+		DecreaseKeys,
+		MaxOpenSize,
+		FunnelIterations,
+		Portals,
+		LocateTime,
+		SearchTime,
+		RestoreTime,
+		FunnelTime,
+		MetricCount
+	};
+
+	static const int BucketCount = 32; //!< The number of buckets of each metric. The last one has all bigger values.
+
+	/*!*******************************************************************
+	\brief
+		   Constructor that makes empty histograms.
+	********************************************************************/
+	SearchStatsHistogram();
+
+	/*!*******************************************************************
+	\brief
+		   Add statistics of one query.
+
+	\param stats
+		   Statistics of finished query.
+	********************************************************************/
+	void Add(const SearchStats& stats);
+	/*!*******************************************************************
+	\brief
+		   Add all queries of other histogram, like those of other
+		   threads.
+
+	\param other
+		   Histogram to add.
+	********************************************************************/
+	void Merge(const SearchStatsHistogram& other);
+	/*!*******************************************************************
+	\brief
+		   Remove all queries.
+	********************************************************************/
+	void Clear();
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of queries added.
+
+	\return int
+			The number of queries.
+	********************************************************************/
+	int GetQueryCount() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the number of queries in given bucket.
+
+	\param metric
+		   Statistic to read.
+
+	\param bucket
+		   Index of bucket, from 0 to BucketCount - 1.
+
+	\return int
+			The number of queries.
+	********************************************************************/
+	int GetBucket(Metric metric, int bucket) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for upper limit of given bucket.
+
+	\param bucket
+		   Index of bucket.
+
+	\return float
+			Values of the bucket are less than this.
+	********************************************************************/
+	static float GetBucketLimit(int bucket);
+	/*!*******************************************************************
+	\brief
+		   Getter method for average of given statistic.
+
+	\param metric
+		   Statistic to read.
+
+	\return float
+			Average of all queries. 0 if there is no query.
+	********************************************************************/
+	float GetMean(Metric metric) const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for the biggest value of given statistic.
+
+	\param metric
+		   Statistic to read.
+
+	\return float
+			The biggest value among all queries.
+	********************************************************************/
+	float GetMax(Metric metric) const;
+	/*!*******************************************************************
+	\brief
+		   Estimate value which given ratio of queries are below.
+
+	\param metric
+		   Statistic to read.
+
+	\param ratio
+		   Ratio of queries, from 0 to 1. 0.99 for 99th percentile.
+
+	\return float
+			Upper limit of bucket having the percentile, so it is never
+			underestimated by more than the bucket.
+	********************************************************************/
+	float GetPercentile(Metric metric, float ratio) const;
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for name of given statistic.
+
+	\param metric
+		   Statistic.
+
+	\return const char*
+			Name for printing.
+	********************************************************************/
+	static const char* GetName(Metric metric);
+
+private:
+	int m_buckets[MetricCount][BucketCount]; //!< The number of queries in each bucket of each metric.
+	double m_sums[MetricCount]; //!< Sum of each metric, for average.
+	float m_maxima[MetricCount]; //!< The biggest value of each metric.
+	int m_count; //!< The number of queries added.
+};
+
+#endif // !SEARCHSTATS_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*!*******************************************************************
+\file		  SearchTrace.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include "SearchTrace.h"
+
+void FullTrace::Clear()
+{
+	m_visited.clear();
+	m_considered.clear();
+}
+
+void FullTrace::Visit(const Point& from, const Point& to)
+{
+	m_visited.push_back(std::make_pair(from, to));
+}
+
+void FullTrace::Consider(const Point& from, const Point& to)
+{
+	m_considered.push_back(std::make_pair(from, to));
+}
+
+const std::vector<std::pair<Point, Point>>& FullTrace::GetVisited() const
+{
+	return m_visited;
+}
+
+const std::vector<std::pair<Point, Point>>& FullTrace::GetConsidered() const
+{
+	return m_considered;
+}
+
+RingTrace::RingTrace(size_t capacity)
+	: m_capacity(capacity)
+{
+	m_visited.m_records.reserve(capacity);
+	m_considered.m_records.reserve(capacity);
+}
+
+void RingTrace::Clear()
+{
+	// Keep memory, so tracing never allocates after the first search.
+	m_visited.m_records.clear();
+	m_visited.m_next = 0;
+	m_considered.m_records.clear();
+	m_considered.m_next = 0;
+}
+
+void RingTrace::Visit(const Point& from, const Point& to)
+{
+	Push(m_visited, from, to);
+}
+
+void RingTrace::Consider(const Point& from, const Point& to)
+{
+	Push(m_considered, from, to);
+}
+
+std::vector<std::pair<Point, Point>> RingTrace::GetVisited() const
+{
+	return Collect(m_visited);
+}
+
+std::vector<std::pair<Point, Point>> RingTrace::GetConsidered() const
+{
+	return Collect(m_considered);
+}
+
+void RingTrace::Push(Ring& ring, const Point& from, const Point& to)
+{
+	if (m_capacity == 0) return;
+
+	// Fill buffer first.
+	if (ring.m_records.size() < m_capacity)
+	{
+		ring.m_records.push_back(std::make_pair(from, to));
+		return;
+	}
+
+	// Overwrite the oldest one.
+	ring.m_records[ring.m_next] = std::make_pair(from, to);
+	ring.m_next = (ring.m_next + 1) % m_capacity;
+}
+
+std::vector<std::pair<Point, Point>> RingTrace::Collect(const Ring& ring) const
+{
+	// The oldest record is at the next position to write.
+	std::vector<std::pair<Point, Point>> records(ring.m_records.begin() + ring.m_next, ring.m_records.end());
+	records.insert(records.end(), ring.m_records.begin(), ring.m_records.begin() + ring.m_next);
+
+	return records;
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+/*!*******************************************************************
+\headerfile   SearchTrace.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for trace policies which record nodes
+			  touched by path search.
+********************************************************************/
+#ifndef SEARCHTRACE_H
+#define SEARCHTRACE_H
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+#include "Point.h"
+
+/*!*******************************************************************
+\class NullTrace
+\brief
+	   Records nothing. Search with this trace does not even compute
+	   what to record, so there is no overhead at all.
+********************************************************************/
+class NullTrace
+{
+public:
+	static const bool IsEnabled = false; //!< Search skips tracing code if it is false.
+
+	void Clear() {}
+	void Visit(const Point&, const Point&) {}
+	void Consider(const Point&, const Point&) {}
+};
+
+/*!*******************************************************************
+\class FullTrace
+\brief
+	   Records every node touched by search. Used for showing how
+	   search proceeded.
+********************************************************************/
+class FullTrace
+{
+public:
+	static const bool IsEnabled = true; //!< Search skips tracing code if it is false.
+
+	/*!*******************************************************************
+	\brief
+		   Remove all records. Called when new search starts.
+	********************************************************************/
+	void Clear();
+	/*!*******************************************************************
+	\brief
+		   Record node closed by search.
+
+	\param from
+		   Origin of closed node.
+
+	\param to
+		   Origin of its parent.
+	********************************************************************/
+	void Visit(const Point& from, const Point& to);
+	/*!*******************************************************************
+	\brief
+		   Record node pushed into open list.
+
+	\param from
+		   Origin of pushed node.
+
+	\param to
+		   Origin of its parent.
+	********************************************************************/
+	void Consider(const Point& from, const Point& to);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for edges to all visited nodes.
+
+	\return const std::vector<std::pair<Point, Point>>&
+			Edges from parent to visited nodes.
+	********************************************************************/
+	const std::vector<std::pair<Point, Point>>& GetVisited() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for edges to all nodes pushed on open list.
+
+	\return const std::vector<std::pair<Point, Point>>&
+			Edges from parent to considered nodes.
+	********************************************************************/
+	const std::vector<std::pair<Point, Point>>& GetConsidered() const;
+
+private:
+	std::vector<std::pair<Point, Point>> m_visited; //!< Container of all visited nodes.
+	std::vector<std::pair<Point, Point>> m_considered; //!< Container of all nodes pushed on open list.
+};
+
+/*!*******************************************************************
+\class RingTrace
+\brief
+	   Records only the latest nodes touched by search, in fixed
+	   size buffers. Memory never grows, so it can be left on for
+	   debugging.
+********************************************************************/
+class RingTrace
+{
+public:
+	static const bool IsEnabled = true; //!< Search skips tracing code if it is false.
+
+	/*!*******************************************************************
+	\brief
+		   Constructor that allocates buffers.
+
+	\param capacity
+		   The number of records kept for each of visited and
+		   considered nodes.
+	********************************************************************/
+	explicit RingTrace(size_t capacity);
+
+	/*!*******************************************************************
+	\brief
+		   Remove all records. Called when new search starts.
+	********************************************************************/
+	void Clear();
+	/*!*******************************************************************
+	\brief
+		   Record node closed by search. Overwrites the oldest record
+		   if buffer is full.
+
+	\param from
+		   Origin of closed node.
+
+	\param to
+		   Origin of its parent.
+	********************************************************************/
+	void Visit(const Point& from, const Point& to);
+	/*!*******************************************************************
+	\brief
+		   Record node pushed into open list. Overwrites the oldest
+		   record if buffer is full.
+
+	\param from
+		   Origin of pushed node.
+
+	\param to
+		   Origin of its parent.
+	********************************************************************/
+	void Consider(const Point& from, const Point& to);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for edges to latest visited nodes.
+
+	\return std::vector<std::pair<Point, Point>>
+			Edges from parent to visited nodes, from oldest to newest.
+	********************************************************************/
+	std::vector<std::pair<Point, Point>> GetVisited() const;
+	/*!*******************************************************************
+	\brief
+		   Getter method for edges to latest nodes pushed on open list.
+
+	\return std::vector<std::pair<Point, Point>>
+			Edges from parent to considered nodes, from oldest to newest.
+	********************************************************************/
+	std::vector<std::pair<Point, Point>> GetConsidered() const;
+
+private:
+	/*!*******************************************************************
+	\struct Ring
+	\brief
+		   Fixed size buffer overwriting the oldest record.
+	********************************************************************/
+	struct Ring
+	{
+		std::vector<std::pair<Point, Point>> m_records; //!< Records. Grows until capacity.
+		size_t m_next = 0; //!< Position to write next record, once buffer is full.
+	};
+
+	/*!*******************************************************************
+	\brief
+		   Push record into given ring.
+
+	\param ring
+		   Ring to push into.
+
+	\param from
+		   First point of record.
+
+	\param to
+		   Second point of record.
+	********************************************************************/
+	void Push(Ring& ring, const Point& from, const Point& to);
+	/*!*******************************************************************
+	\brief
+		   Copy records of given ring in order.
+
+	\param ring
+		   Ring to copy.
+
+	\return std::vector<std::pair<Point, Point>>
+			Records from oldest to newest.
+	********************************************************************/
+	std::vector<std::pair<Point, Point>> Collect(const Ring& ring) const;
+
+private:
+	size_t m_capacity; //!< The number of records kept for each ring.
+	Ring m_visited; //!< Latest visited nodes.
+	Ring m_considered; //!< Latest nodes pushed on open list.
+};
+
+#endif // !SEARCHTRACE_H
\ No newline at end of file
@@ -32,6 +32,11 @@ void SearchingArea::Update(const Point& mouse)
 	}
 }
 
+void SearchingArea::PollPath()
+{
+	m_astar.Poll();
+}
+
 void SearchingArea::Draw(Render* render, bool editMode, bool showAllNodes, bool smoothPath) const
 {
 	// Draw boundary
@@ -122,11 +127,21 @@ void SearchingArea::SetEndPoint(const Point& end)
 	m_astar.SetEnd(end);
 }
 
+void SearchingArea::SetRandomPoints()
+{
+	m_astar.SetRandomPoints();
+}
+
 void SearchingArea::SetWeight(float weight)
 {
 	m_astar.SetWeight(weight);
 }
 
+void SearchingArea::SetRadius(float radius)
+{
+	m_astar.SetRadius(radius);
+}
+
 void SearchingArea::SetConsideredColor(const Color& color)
 {
 	m_astar.SetConsideredColor(color);
@@ -57,6 +57,12 @@ public:
 	********************************************************************/
 	void Update(const Point& mouse);
 	/*!*******************************************************************
+	\brief
+		   Abstracted method for taking finished path.
+		   Call related method of object under hierarchy.
+	********************************************************************/
+	void PollPath();
+	/*!*******************************************************************
 	\brief
 		   Draws boundary and holes.
 		   Draws nav meshes and path, if it is not edit mode.
@@ -120,6 +126,13 @@ public:
 	********************************************************************/
 	void SetEndPoint(const Point& end);
 	/*!*******************************************************************
+	\brief
+		   Abstracted method for moving both ends of path to random
+		   points connected to each other.
+		   Call related method of object under hierarchy.
+	********************************************************************/
+	void SetRandomPoints();
+	/*!*******************************************************************
 	\brief
 		   Abstracted setter method for weight.
 
@@ -127,6 +140,14 @@ public:
 		   New weight.
 	********************************************************************/
 	void SetWeight(float weight);
+	/*!*******************************************************************
+	\brief
+		   Abstracted setter method for radius of agent.
+
+	\param radius
+		   New radius.
+	********************************************************************/
+	void SetRadius(float radius);
 
 	/*!*******************************************************************
 	\brief
@@ -0,0 +1,89 @@
+/*!*******************************************************************
+\file		  SpatialHash.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <cmath>
+
+#include "SpatialHash.h"
+
+void SpatialHash::Build(const std::vector<Point>& positions, float cellSize)
+{
+	m_positions = &positions;
+	m_cellSize = cellSize;
+
+	// About two buckets for each item, so collisions are rare.
+	const int size = static_cast<int>(positions.size());
+	int bucketCount = 1;
+	while (bucketCount < size * 2)
+		bucketCount *= 2;
+
+	m_mask = bucketCount - 1;
+
+	// Count items of each bucket.
+	std::vector<int> buckets(size);
+	m_offsets.assign(bucketCount + 1, 0);
+
+	for (int i = 0; i < size; ++i)
+	{
+		buckets[i] = GetBucket(GetCell(positions[i].X), GetCell(positions[i].Y));
+		++m_offsets[buckets[i] + 1];
+	}
+
+	for (int i = 0; i < bucketCount; ++i)
+		m_offsets[i + 1] += m_offsets[i];
+
+	// Put each item into range of its bucket.
+	std::vector<int> next(m_offsets.begin(), m_offsets.end() - 1);
+	m_items.resize(size);
+
+	for (int i = 0; i < size; ++i)
+		m_items[next[buckets[i]]++] = i;
+}
+
+void SpatialHash::Query(const Point& center, float radius, std::vector<int>& items) const
+{
+	if (m_positions == nullptr) return;
+
+	const auto& positions = *m_positions;
+	const float radiusSq = radius * radius;
+
+	const int minX = GetCell(center.X - radius);
+	const int maxX = GetCell(center.X + radius);
+	const int minY = GetCell(center.Y - radius);
+	const int maxY = GetCell(center.Y + radius);
+
+	for (int y = minY; y <= maxY; ++y)
+	{
+		for (int x = minX; x <= maxX; ++x)
+		{
+			const int bucket = GetBucket(x, y);
+
+			// Other cells can share the bucket. Only take items of this cell, so nothing is found twice.
+			for (int i = m_offsets[bucket]; i < m_offsets[bucket + 1]; ++i)
+			{
+				const int item = m_items[i];
+				if (GetCell(positions[item].X) != x || GetCell(positions[item].Y) != y) continue;
+
+				const float dx = positions[item].X - center.X;
+				const float dy = positions[item].Y - center.Y;
+
+				if (dx * dx + dy * dy <= radiusSq)
+					items.push_back(item);
+			}
+		}
+	}
+}
+
+int SpatialHash::GetBucket(int x, int y) const
+{
+	// Mix coordinates with large primes.
+	const unsigned hash = static_cast<unsigned>(x) * 73856093u ^ static_cast<unsigned>(y) * 19349663u;
+	return static_cast<int>(hash & static_cast<unsigned>(m_mask));
+}
+
+int SpatialHash::GetCell(float value) const
+{
+	return static_cast<int>(std::floor(value / m_cellSize));
+}
\ No newline at end of file
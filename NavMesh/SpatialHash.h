@@ -0,0 +1,91 @@
+/*!*******************************************************************
+\headerfile   SpatialHash.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for SpatialHash class which finds items
+			  near a point.
+********************************************************************/
+#ifndef SPATIALHASH_H
+#define SPATIALHASH_H
+
+#include <vector>
+
+#include "Point.h"
+
+/*!*******************************************************************
+\class SpatialHash
+\brief
+	   Uniform grid hashed into fixed number of buckets. Rebuilt
+	   from scratch with all items at once, and stores items of each
+	   bucket contiguously, so queries only read flat arrays.
+********************************************************************/
+class SpatialHash
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Replace all items with given positions. Index of position is
+		   the item.
+
+	\param positions
+		   Position of each item.
+
+	\param cellSize
+		   Width and height of each cell. Queries are fastest when it
+		   is about the query radius.
+	********************************************************************/
+	void Build(const std::vector<Point>& positions, float cellSize);
+
+	/*!*******************************************************************
+	\brief
+		   Find items within given distance from given point.
+
+	\param center
+		   Point to search around.
+
+	\param radius
+		   Distance to search.
+
+	\param items
+		   Index of found items are pushed into here. Not cleared.
+	********************************************************************/
+	void Query(const Point& center, float radius, std::vector<int>& items) const;
+
+private:
+	/*!*******************************************************************
+	\brief
+		   Compute bucket of given cell.
+
+	\param x
+		   Column of the cell.
+
+	\param y
+		   Row of the cell.
+
+	\return int
+			Index of bucket.
+	********************************************************************/
+	int GetBucket(int x, int y) const;
+	/*!*******************************************************************
+	\brief
+		   Compute cell coordinate of given value.
+
+	\param value
+		   X or y coordinate of a point.
+
+	\return int
+			Column or row.
+	********************************************************************/
+	int GetCell(float value) const;
+
+private:
+	const std::vector<Point>* m_positions = nullptr; //!< Positions given to the last build.
+	float m_cellSize = 1.f; //!< Width and height of each cell.
+	int m_mask = 0; //!< The number of buckets - 1. The number of buckets is power of two.
+	std::vector<int> m_offsets; //!< Items of bucket i are from m_items[m_offsets[i]] to m_items[m_offsets[i + 1]].
+	std::vector<int> m_items; //!< Index of items sorted by bucket.
+};
+
+#endif // !SPATIALHASH_H
\ No newline at end of file
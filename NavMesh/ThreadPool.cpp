@@ -0,0 +1,91 @@
+/*!*******************************************************************
+\file		  ThreadPool.cpp
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+********************************************************************/
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int threadCount)
+{
+	for (int i = 1; i < threadCount; ++i)
+		m_workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isStopping = true;
+	}
+
+	m_wake.notify_all();
+	for (auto& worker : m_workers)
+		worker.join();
+}
+
+void ThreadPool::Run(int threadCount, const std::function<void(int)>& function)
+{
+	threadCount = std::max(std::min(threadCount, GetThreadCount()), 1);
+
+	// Not worth to wake workers.
+	if (threadCount < 2)
+	{
+		function(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_function = &function;
+		m_activeCount = threadCount - 1;
+		m_runningCount = threadCount - 1;
+		++m_generation;
+	}
+
+	m_wake.notify_all();
+	function(0);
+
+	// Function lives on this stack, so workers must be done with it before returning.
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_runningCount == 0; });
+	m_function = nullptr;
+}
+
+int ThreadPool::GetThreadCount() const
+{
+	return static_cast<int>(m_workers.size()) + 1;
+}
+
+void ThreadPool::WorkerLoop(int index)
+{
+	unsigned generation = 0;
+
+	while (true)
+	{
+		const std::function<void(int)>* function;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&]() { return m_isStopping || (m_generation != generation && index <= m_activeCount); });
+
+			if (m_isStopping)
+				return;
+
+			generation = m_generation;
+			function = m_function;
+		}
+
+		(*function)(index);
+
+		bool isLast;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			isLast = --m_runningCount == 0;
+		}
+
+		if (isLast)
+			m_done.notify_one();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+/*!*******************************************************************
+\headerfile   ThreadPool.h
+\author       Kim Hyungseob
+\par          email: hn02415 \@ gmail.com
+\date         2026/10/19
+\brief
+			  Header file for ThreadPool class which keeps worker
+			  threads alive between parallel loops.
+********************************************************************/
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+/*!*******************************************************************
+\class ThreadPool
+\brief
+	   Fixed set of worker threads, started once and woken for each
+	   call of Run. Calling thread works too, so pool of n threads
+	   has n - 1 workers. Shared by systems updated on same thread,
+	   like crowd and distance queries, so threads are not made on
+	   every update.
+********************************************************************/
+class ThreadPool
+{
+public:
+	/*!*******************************************************************
+	\brief
+		   Constructor that starts worker threads.
+
+	\param threadCount
+		   The number of threads running each call, including calling
+		   thread. If it is less than 2, no worker is started.
+	********************************************************************/
+	explicit ThreadPool(int threadCount);
+	/*!*******************************************************************
+	\brief
+		   Destructor that stops and joins all workers.
+	********************************************************************/
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/*!*******************************************************************
+	\brief
+		   Call given function once on each thread, and wait until all
+		   of them return. Function usually takes work from shared
+		   atomic counter until nothing is left.
+		   Must be called by one thread at a time.
+
+	\param threadCount
+		   The number of threads to use. Clamped to size of pool.
+
+	\param function
+		   Function takes index of thread, from 0 to threadCount - 1.
+		   Calling thread is 0.
+	********************************************************************/
+	void Run(int threadCount, const std::function<void(int)>& function);
+
+	/*!*******************************************************************
+	\brief
+		   Getter method for size of pool.
+
+	\return int
+			The number of threads including calling thread.
+	********************************************************************/
+	int GetThreadCount() const;
+
+private:
+	/*!*******************************************************************
+	\brief
+		   Loop of each worker thread. Sleeps until next call of Run
+		   uses it, or pool stops.
+
+	\param index
+		   Index of this thread. Workers start from 1.
+	********************************************************************/
+	void WorkerLoop(int index);
+
+private:
+	std::mutex m_mutex; //!< Guards all variables below.
+	std::condition_variable m_wake; //!< Wakes up workers when new call starts or pool stops.
+	std::condition_variable m_done; //!< Wakes up calling thread when the last worker finishes.
+	bool m_isStopping = false; //!< True if workers have to stop.
+	unsigned m_generation = 0; //!< Increased by each call, so each worker runs a call once.
+	int m_activeCount = 0; //!< The number of workers used by current call.
+	int m_runningCount = 0; //!< The number of workers still running current call.
+	const std::function<void(int)>* m_function = nullptr; //!< Function of current call. Owned by calling thread.
+
+	std::vector<std::thread> m_workers; //!< Worker threads.
+};
+
+#endif // !THREADPOOL_H
\ No newline at end of file
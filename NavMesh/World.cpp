@@ -23,6 +23,11 @@ void World::Update(Point mouse)
 	m_area.Update(ToWorldCoordinate(mouse));
 }
 
+void World::PollPath()
+{
+	m_area.PollPath();
+}
+
 void World::Draw(Render* render, bool editMode, bool showAllNodes, bool smoothPath) const
 {
 	m_area.Draw(render, editMode, showAllNodes, smoothPath);
@@ -68,11 +73,21 @@ void World::SetEndPoint(const Point& end)
 	m_area.SetEndPoint(ToWorldCoordinate(end));
 }
 
+void World::SetRandomPoints()
+{
+	m_area.SetRandomPoints();
+}
+
 void World::SetWeight(float weight)
 {
 	m_area.SetWeight(weight);
 }
 
+void World::SetRadius(float radius)
+{
+	m_area.SetRadius(radius);
+}
+
 void World::SetConsideredColor(const Color& color)
 {
 	m_area.SetConsideredColor(color);
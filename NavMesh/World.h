@@ -53,6 +53,12 @@ public:
 	********************************************************************/
 	void Update(Point mouse);
 	/*!*******************************************************************
+	\brief
+		   Abstracted method for taking finished path.
+		   Call related method of object under hierarchy.
+	********************************************************************/
+	void PollPath();
+	/*!*******************************************************************
 	\brief
 		   Abstracted draw method.
 		   Call related draw method of object under hierarchy.
@@ -129,6 +135,13 @@ public:
 	********************************************************************/
 	void SetEndPoint(const Point& end);
 	/*!*******************************************************************
+	\brief
+		   Abstracted method for moving both ends of path to random
+		   points connected to each other.
+		   Call related method of object under hierarchy.
+	********************************************************************/
+	void SetRandomPoints();
+	/*!*******************************************************************
 	\brief
 		   Abstracted setter method for weight.
 
@@ -136,6 +149,14 @@ public:
 		   New weight.
 	********************************************************************/
 	void SetWeight(float weight);
+	/*!*******************************************************************
+	\brief
+		   Abstracted setter method for radius of agent.
+
+	\param radius
+		   New radius.
+	********************************************************************/
+	void SetRadius(float radius);
 
 	/*!*******************************************************************
 	\brief
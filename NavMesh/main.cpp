@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cstring>
 
 #include <GL/glew.h>
 #include <SDL2/SDL.h>
@@ -6,9 +7,14 @@
 #include "Color.h"
 #include "ImGuiClient.h"
 #include "Client.h"
+#include "Benchmark.h"
 
-int main(int /*argc*/, char* /*argv*/[])
+int main(int argc, char* argv[])
 {
+	// Measure searches without window, and quit.
+	if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0)
+		return Benchmark::Run(argc - 2, argv + 2, std::cout);
+
 	// SDL: Initialize and create a window
 	if (SDL_Init(SDL_INIT_VIDEO) != 0)
 	{
@@ -51,6 +57,7 @@ int main(int /*argc*/, char* /*argv*/[])
 		bool editMode = false;
 		bool showAllNodes = true;
 		float weight = 1.f;
+		float radius = 0.f;
 		// Path, Considered, Visited, NavMesh
 		Color colors[4] = { RED, BLUE, ORANGE, GRAY };
 		bool smoothPath = true;
@@ -114,7 +121,7 @@ int main(int /*argc*/, char* /*argv*/[])
 			last_ticks = ticks;
 			
 			// Show ImGui and handle input
-			switch (imguiClient.Draw(window, editMode, showAllNodes, weight, colors, smoothPath))
+			switch (imguiClient.Draw(window, editMode, showAllNodes, weight, radius, colors, smoothPath))
 			{
 			case ImGuiClient::Event::AddHole:
 				client.AddHole();
@@ -125,10 +132,18 @@ int main(int /*argc*/, char* /*argv*/[])
 					client.GenerateNavMesh();
 				break;
 
+			case ImGuiClient::Event::RandomPointsPressed:
+				client.SetRandomPoints();
+				break;
+
 			case ImGuiClient::Event::WeightChanged:
 				client.SetWeight(weight);
 				break;
 
+			case ImGuiClient::Event::RadiusChanged:
+				client.SetRadius(radius);
+				break;
+
 			case ImGuiClient::Event::PathColorChanged:
 				client.SetPathColor(colors[0]);
 				break;